@@ -0,0 +1,65 @@
+#include "llcl/Standard/MemoryAllocator/HugePageArena.h"
+
+#include <benchmark/benchmark.h>
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::HugePageArena;
+using llcl::standard::ma::NewDeleteAllocator;
+
+// Chase a random cyclic permutation spread over 'num_bytes' bytes of memory
+// from the specified 'allocator', the access pattern of a large hash index,
+// where nearly every hop is a TLB miss with 4KiB pages.
+void chase(benchmark::State& state, Allocator* allocator) {
+  const std::size_t num_bytes = static_cast<std::size_t>(state.range(0)) << 20;
+  const std::size_t num_slots = num_bytes / sizeof(std::size_t);
+  std::size_t* slots =
+      static_cast<std::size_t*>(allocator->allocate(num_bytes));
+
+  // Sattolo's algorithm, with a fixed linear congruential generator.
+  for (std::size_t i = 0; i < num_slots; ++i) {
+    slots[i] = i;
+  }
+  unsigned long long seed = 42;
+  for (std::size_t i = num_slots - 1; i > 0; --i) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    const std::size_t j = (seed >> 33) % i;
+    const std::size_t tmp = slots[i];
+    slots[i] = slots[j];
+    slots[j] = tmp;
+  }
+
+  std::size_t index = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < 1024; ++i) {
+      index = slots[index];
+    }
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(state.iterations() * 1024);
+
+  allocator->deallocate(slots);
+}
+
+void BM_ChaseNewDelete(benchmark::State& state) {
+  chase(state, &NewDeleteAllocator::singleton());
+}
+BENCHMARK(BM_ChaseNewDelete)->Arg(64)->Arg(512);
+
+void BM_ChaseHugePageArena(benchmark::State& state) {
+  HugePageArena arena(HugePageArena::DEFAULT_CHUNK_SIZE,
+                      HugePageArena::PREFAULT);
+  chase(state, &arena);
+}
+BENCHMARK(BM_ChaseHugePageArena)->Arg(64)->Arg(512);
+
+}  // namespace
+}  // namespace llcl
+
+#endif  // LLCL_PLATFORM_OS_UNIX
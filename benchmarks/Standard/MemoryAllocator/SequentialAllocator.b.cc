@@ -0,0 +1,101 @@
+#include "llcl/Standard/MemoryAllocator/SequentialAllocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include "llcl/Standard/MemoryAllocator/BufferedSequentialAllocator.h"
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::BufferedSequentialAllocator;
+using llcl::standard::ma::NewDeleteAllocator;
+using llcl::standard::ma::SequentialAllocator;
+
+// Sizes of the short-lived objects created while handling one request.
+const Allocator::size_type k_sizes[] = {16, 24, 48, 32, 8, 64, 128, 40};
+const int k_num_sizes = sizeof k_sizes / sizeof *k_sizes;
+
+// Simulate one request: allocate 'num_objects' small objects, touch them, and
+// give them all back.
+void handleRequest(Allocator* allocator, void** objects, int num_objects) {
+  for (int i = 0; i < num_objects; ++i) {
+    objects[i] = allocator->allocate(k_sizes[i % k_num_sizes]);
+    *static_cast<char*>(objects[i]) = static_cast<char>(i);
+  }
+  benchmark::ClobberMemory();
+  for (int i = 0; i < num_objects; ++i) {
+    allocator->deallocate(objects[i]);
+  }
+}
+
+void BM_NewDeleteAllocator(benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  void** objects = new void*[num_objects];
+  Allocator* allocator = &NewDeleteAllocator::singleton();
+
+  for (auto _ : state) {
+    handleRequest(allocator, objects, num_objects);
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+  delete[] objects;
+}
+BENCHMARK(BM_NewDeleteAllocator)->Arg(64)->Arg(1024)->Arg(16384);
+
+void BM_SequentialAllocator(benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  void** objects = new void*[num_objects];
+
+  for (auto _ : state) {
+    SequentialAllocator allocator;
+    handleRequest(&allocator, objects, num_objects);
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+  delete[] objects;
+}
+BENCHMARK(BM_SequentialAllocator)->Arg(64)->Arg(1024)->Arg(16384);
+
+void BM_SequentialAllocatorReused(benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  void** objects = new void*[num_objects];
+  SequentialAllocator allocator;
+
+  for (auto _ : state) {
+    handleRequest(&allocator, objects, num_objects);
+    allocator.release();
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+  delete[] objects;
+}
+BENCHMARK(BM_SequentialAllocatorReused)->Arg(64)->Arg(1024)->Arg(16384);
+
+void BM_SequentialAllocatorStackBuffer(benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  void** objects = new void*[num_objects];
+
+  for (auto _ : state) {
+    alignas(Allocator::MAX_ALIGNMENT) char buffer[4096];
+    SequentialAllocator allocator(buffer, sizeof buffer);
+    handleRequest(&allocator, objects, num_objects);
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+  delete[] objects;
+}
+BENCHMARK(BM_SequentialAllocatorStackBuffer)->Arg(64)->Arg(1024)->Arg(16384);
+
+void BM_BufferedSequentialAllocator(benchmark::State& state) {
+  const int num_objects = static_cast<int>(state.range(0));
+  void** objects = new void*[num_objects];
+
+  for (auto _ : state) {
+    BufferedSequentialAllocator<4096> allocator;
+    handleRequest(&allocator, objects, num_objects);
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+  delete[] objects;
+}
+BENCHMARK(BM_BufferedSequentialAllocator)->Arg(64)->Arg(1024)->Arg(16384);
+
+}  // namespace
+}  // namespace llcl
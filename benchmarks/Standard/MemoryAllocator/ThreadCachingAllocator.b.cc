@@ -0,0 +1,74 @@
+#include "llcl/Standard/MemoryAllocator/ThreadCachingAllocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include "llcl/Standard/MemoryAllocator/Multipool.h"
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::Multipool;
+using llcl::standard::ma::NewDeleteAllocator;
+using llcl::standard::ma::ThreadCachingAllocator;
+
+// A 'Multipool' shared by all threads behind a single mutex: the baseline
+// the thread cache is meant to beat.
+class my_LockedMultipool : public Allocator {
+  Multipool d_multipool;
+  standard::mt::Mutex d_lock;
+
+ public:
+  void* allocate(size_type size) override {
+    d_lock.lock();
+    void* address = d_multipool.allocate(size);
+    d_lock.unlock();
+    return address;
+  }
+
+  void deallocate(void* address) override {
+    d_lock.lock();
+    d_multipool.deallocate(address);
+    d_lock.unlock();
+  }
+};
+
+const int k_batch = 64;
+
+// Allocate and free a batch of mixed small blocks on the calling thread.
+void churn(benchmark::State& state, Allocator* allocator) {
+  void* blocks[k_batch];
+  for (auto _ : state) {
+    for (int i = 0; i < k_batch; ++i) {
+      blocks[i] = allocator->allocate(16 << (i % 5));
+    }
+    benchmark::DoNotOptimize(blocks);
+    for (int i = 0; i < k_batch; ++i) {
+      allocator->deallocate(blocks[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * k_batch);
+}
+
+my_LockedMultipool g_locked_multipool;
+ThreadCachingAllocator g_thread_caching(&g_locked_multipool);
+
+void BM_NewDelete(benchmark::State& state) {
+  churn(state, &NewDeleteAllocator::singleton());
+}
+BENCHMARK(BM_NewDelete)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_LockedMultipool(benchmark::State& state) {
+  churn(state, &g_locked_multipool);
+}
+BENCHMARK(BM_LockedMultipool)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_ThreadCaching(benchmark::State& state) {
+  churn(state, &g_thread_caching);
+}
+BENCHMARK(BM_ThreadCaching)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,46 @@
+#include "llcl/Standard/MultiThread/Barrier.h"
+
+#include <benchmark/benchmark.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Barrier;
+
+// Synchronize all benchmark threads once per iteration.
+void BM_Barrier(benchmark::State& state) {
+  static Barrier* barrier;
+  if (0 == state.thread_index()) {
+    barrier = new Barrier(state.threads());
+  }
+  // The benchmark library starts and ends the timed loop of all threads
+  // together, so thread 0 can set up and tear down outside of it.
+  for (auto _ : state) {
+    barrier->wait();
+  }
+  if (0 == state.thread_index()) {
+    delete barrier;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PthreadBarrier(benchmark::State& state) {
+  static pthread_barrier_t barrier;
+  if (0 == state.thread_index()) {
+    pthread_barrier_init(&barrier, 0, state.threads());
+  }
+  for (auto _ : state) {
+    pthread_barrier_wait(&barrier);
+  }
+  if (0 == state.thread_index()) {
+    pthread_barrier_destroy(&barrier);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Barrier)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_PthreadBarrier)->ThreadRange(2, 16)->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,94 @@
+#include "llcl/Standard/MultiThread/Condition.h"
+
+#include <benchmark/benchmark.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::ConditionImpl;
+using llcl::standard::mt::MutexImpl;
+using llcl::standard::mt::Platform;
+
+template <class POLICY>
+struct my_Pool {
+  MutexImpl<POLICY> d_mutex;
+  ConditionImpl<POLICY> d_work;
+  ConditionImpl<POLICY> d_done;
+  int d_generation = 0;
+  int d_num_done = 0;
+  int d_num_workers = 0;
+  bool d_stop = false;
+};
+
+// Wait for each new generation and report back, like a worker pool woken
+// for every batch.
+template <class POLICY>
+void* my_work(void* arg) {
+  my_Pool<POLICY>* pool = static_cast<my_Pool<POLICY>*>(arg);
+  // Start from the initial generation: the first broadcast may come before
+  // this thread gets to run.
+  int generation = 0;
+  pool->d_mutex.lock();
+  for (;;) {
+    while (generation == pool->d_generation && !pool->d_stop) {
+      pool->d_work.wait(&pool->d_mutex);
+    }
+    if (pool->d_stop) {
+      break;
+    }
+    generation = pool->d_generation;
+    if (pool->d_num_workers == ++pool->d_num_done) {
+      pool->d_done.signal();
+    }
+  }
+  pool->d_mutex.unlock();
+  return 0;
+}
+
+// Broadcast to 'state.range(0)' waiting threads and wait until every one of
+// them has run.
+template <class POLICY>
+void BM_Broadcast(benchmark::State& state) {
+  my_Pool<POLICY> pool;
+  pool.d_num_workers = static_cast<int>(state.range(0));
+
+  pthread_t threads[64];
+  for (int i = 0; i < pool.d_num_workers; ++i) {
+    pthread_create(&threads[i], 0, &my_work<POLICY>, &pool);
+  }
+
+  for (auto _ : state) {
+    pool.d_mutex.lock();
+    pool.d_num_done = 0;
+    ++pool.d_generation;
+    pool.d_work.broadcast();
+    while (pool.d_num_done < pool.d_num_workers) {
+      pool.d_done.wait(&pool.d_mutex);
+    }
+    pool.d_mutex.unlock();
+  }
+
+  pool.d_mutex.lock();
+  pool.d_stop = true;
+  pool.d_work.broadcast();
+  pool.d_mutex.unlock();
+  for (int i = 0; i < pool.d_num_workers; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  state.SetItemsProcessed(state.iterations() * pool.d_num_workers);
+}
+
+BENCHMARK_TEMPLATE(BM_Broadcast, Platform::PosixThreads)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime();
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+BENCHMARK_TEMPLATE(BM_Broadcast, Platform::FutexThreads)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime();
+#endif
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,96 @@
+#include "llcl/Standard/MultiThread/MpmcQueue.h"
+
+#include <benchmark/benchmark.h>
+
+#include "llcl/Standard/MultiThread/Condition.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Condition;
+using llcl::standard::mt::MpmcQueue;
+using llcl::standard::mt::Mutex;
+
+const int k_capacity = 1024;
+
+// The baseline: a ring guarded by a 'Mutex', with a 'Condition' per end.
+class my_LockedQueue {
+  Mutex d_lock;
+  Condition d_not_full;
+  Condition d_not_empty;
+  int d_values[k_capacity];
+  int d_head;
+  int d_size;
+
+ public:
+  explicit my_LockedQueue(int) : d_head(0), d_size(0) {}
+
+  void pop(int* value) {
+    d_lock.lock();
+    while (0 == d_size) {
+      d_not_empty.wait(&d_lock);
+    }
+    *value = d_values[d_head];
+    d_head = (d_head + 1) % k_capacity;
+    --d_size;
+    d_not_full.signal();
+    d_lock.unlock();
+  }
+
+  void push(int value) {
+    d_lock.lock();
+    while (k_capacity == d_size) {
+      d_not_full.wait(&d_lock);
+    }
+    d_values[(d_head + d_size) % k_capacity] = value;
+    ++d_size;
+    d_not_empty.signal();
+    d_lock.unlock();
+  }
+};
+
+// A push and a pop by the same thread: the cost of the queue itself.
+void BM_Uncontended(benchmark::State& state) {
+  MpmcQueue<int> queue(k_capacity);
+  int value = 0;
+  for (auto _ : state) {
+    queue.tryPush(value);
+    queue.tryPop(&value);
+  }
+  benchmark::DoNotOptimize(value);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Even threads push and odd threads pop, one value per iteration each.
+template <class QUEUE>
+void BM_ProducersConsumers(benchmark::State& state) {
+  static QUEUE* queue;
+  if (0 == state.thread_index()) {
+    queue = new QUEUE(k_capacity);
+  }
+  const bool producer = 0 == state.thread_index() % 2;
+  int value = state.thread_index();
+  for (auto _ : state) {
+    if (producer) {
+      queue->push(value);
+    } else {
+      queue->pop(&value);
+    }
+  }
+  if (0 == state.thread_index()) {
+    delete queue;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Uncontended);
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, MpmcQueue<int>)
+    ->ThreadRange(2, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, my_LockedQueue)
+    ->ThreadRange(2, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
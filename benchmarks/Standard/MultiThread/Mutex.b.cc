@@ -0,0 +1,90 @@
+#include "llcl/Standard/MultiThread/Mutex.h"
+
+#include <benchmark/benchmark.h>
+#include <pthread.h>
+
+#include "llcl/Standard/MultiThread/AdaptiveMutex.h"
+#include "llcl/Standard/MultiThread/ClhLock.h"
+#include "llcl/Standard/MultiThread/McsLock.h"
+#include "llcl/Standard/MultiThread/TicketLock.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::AdaptiveMutex;
+using llcl::standard::mt::ClhLock;
+using llcl::standard::mt::McsLock;
+using llcl::standard::mt::MutexImpl;
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::TicketLock;
+
+void* doNothing(void*) { return 0; }
+
+// glibc skips the atomic instructions in 'pthread_mutex_lock' and
+// 'pthread_mutex_unlock' until the process has created its first thread,
+// which would flatter the single-threaded pthread runs.
+struct my_GoMultiThreaded {
+  my_GoMultiThreaded() {
+    pthread_t thread;
+    pthread_create(&thread, 0, &doNothing, 0);
+    pthread_join(thread, 0);
+  }
+} g_go_multi_threaded;
+
+// A mutex and the data it guards, kept apart from other instances.
+template <class MUTEX>
+struct alignas(Platform::CACHE_LINE_SIZE) my_Guarded {
+  MUTEX d_lock;
+  long d_value = 0;
+};
+
+// Lock and unlock a mutex no other thread touches.
+template <class MUTEX>
+void BM_Uncontended(benchmark::State& state) {
+  my_Guarded<MUTEX> guarded;
+  for (auto _ : state) {
+    guarded.d_lock.lock();
+    ++guarded.d_value;
+    guarded.d_lock.unlock();
+  }
+  benchmark::DoNotOptimize(guarded.d_value);
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] = sizeof(MUTEX);
+}
+
+// All threads hammer one mutex guarding a short critical section of
+// 'state.range(0)' dependent increments.
+template <class MUTEX>
+void BM_Contended(benchmark::State& state) {
+  static my_Guarded<MUTEX> guarded;
+  const long work = state.range(0);
+  for (auto _ : state) {
+    guarded.d_lock.lock();
+    for (long i = 0; i < work; ++i) {
+      benchmark::DoNotOptimize(++guarded.d_value);
+    }
+    guarded.d_lock.unlock();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define LLCL_MUTEX_BENCHMARKS(MUTEX)                                  \
+  BENCHMARK_TEMPLATE(BM_Uncontended, MUTEX);                          \
+  BENCHMARK_TEMPLATE(BM_Contended, MUTEX)                             \
+      ->Arg(1)                                                        \
+      ->Arg(100)                                                      \
+      ->ThreadRange(1, 16)                                            \
+      ->UseRealTime()
+
+LLCL_MUTEX_BENCHMARKS(MutexImpl<Platform::PosixThreads>);
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+LLCL_MUTEX_BENCHMARKS(MutexImpl<Platform::FutexThreads>);
+LLCL_MUTEX_BENCHMARKS(AdaptiveMutex);
+#endif
+LLCL_MUTEX_BENCHMARKS(TicketLock);
+LLCL_MUTEX_BENCHMARKS(McsLock);
+LLCL_MUTEX_BENCHMARKS(ClhLock);
+LLCL_MUTEX_BENCHMARKS(MutexImpl<Platform::InstrumentedThreads>);
+
+}  // namespace
+}  // namespace llcl
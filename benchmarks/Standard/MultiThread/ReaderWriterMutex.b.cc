@@ -0,0 +1,55 @@
+#include "llcl/Standard/MultiThread/ReaderWriterMutex.h"
+
+#include <benchmark/benchmark.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::ReaderWriterMutex;
+using llcl::standard::mt::ReaderWriterMutexImpl;
+
+// A reader-writer mutex and the data it guards.
+template <class MUTEX>
+struct alignas(Platform::CACHE_LINE_SIZE) my_Guarded {
+  MUTEX d_lock;
+  long d_value = 0;
+};
+
+// All threads read the guarded value, and one access in 'state.range(0)'
+// is a write.
+template <class MUTEX>
+void BM_ReadMostly(benchmark::State& state) {
+  static my_Guarded<MUTEX> guarded;
+  const long write_every = state.range(0);
+  long n = state.thread_index();
+  for (auto _ : state) {
+    if (0 == ++n % write_every) {
+      guarded.d_lock.lock();
+      ++guarded.d_value;
+      guarded.d_lock.unlock();
+    } else {
+      guarded.d_lock.lock_shared();
+      benchmark::DoNotOptimize(guarded.d_value);
+      guarded.d_lock.unlock_shared();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["bytes"] =
+      benchmark::Counter(sizeof(MUTEX), benchmark::Counter::kAvgThreads);
+}
+
+#define LLCL_READER_WRITER_MUTEX_BENCHMARKS(MUTEX)                     \
+  BENCHMARK_TEMPLATE(BM_ReadMostly, MUTEX)                             \
+      ->Arg(1000000000)                                                \
+      ->Arg(1000)                                                      \
+      ->Arg(10)                                                        \
+      ->ThreadRange(1, 16)                                             \
+      ->UseRealTime()
+
+LLCL_READER_WRITER_MUTEX_BENCHMARKS(ReaderWriterMutex);
+LLCL_READER_WRITER_MUTEX_BENCHMARKS(
+    ReaderWriterMutexImpl<Platform::ReaderBiased>);
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,49 @@
+#include "llcl/Standard/MultiThread/Semaphore.h"
+
+#include <benchmark/benchmark.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::Semaphore;
+using llcl::standard::mt::SemaphoreImpl;
+
+// Post and take back a unit with no other thread involved.
+template <class SEMAPHORE>
+void BM_PostWait(benchmark::State& state) {
+  SEMAPHORE sem;
+  for (auto _ : state) {
+    sem.post();
+    sem.wait();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Two threads hand a token back and forth through a pair of semaphores.
+template <class SEMAPHORE>
+void BM_PingPong(benchmark::State& state) {
+  static SEMAPHORE ping;
+  static SEMAPHORE pong;
+  const bool first = 0 == state.thread_index();
+  for (auto _ : state) {
+    if (first) {
+      ping.post();
+      pong.wait();
+    } else {
+      ping.wait();
+      pong.post();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define LLCL_SEMAPHORE_BENCHMARKS(SEMAPHORE)                              \
+  BENCHMARK_TEMPLATE(BM_PostWait, SEMAPHORE);                             \
+  BENCHMARK_TEMPLATE(BM_PingPong, SEMAPHORE)->Threads(2)->UseRealTime()
+
+LLCL_SEMAPHORE_BENCHMARKS(SemaphoreImpl<Platform::PosixSemaphore>);
+LLCL_SEMAPHORE_BENCHMARKS(SemaphoreImpl<Platform::CountedSemaphore>);
+
+}  // namespace
+}  // namespace llcl
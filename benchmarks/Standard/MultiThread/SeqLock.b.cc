@@ -0,0 +1,79 @@
+#include "llcl/Standard/MultiThread/SeqLock.h"
+
+#include <benchmark/benchmark.h>
+
+#include "llcl/Standard/MultiThread/ReaderWriterMutex.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::ReaderWriterMutex;
+using llcl::standard::mt::SeqLock;
+
+// A small snapshot record, as published to many readers.
+struct my_Quote {
+  double d_bid;
+  double d_ask;
+  long d_bid_size;
+  long d_ask_size;
+  long d_timestamp;
+};
+
+// All threads read the snapshot, and one access in 'state.range(0)' is a
+// write.
+void BM_SeqLock(benchmark::State& state) {
+  alignas(Platform::CACHE_LINE_SIZE) static SeqLock<my_Quote> lock;
+  const long write_every = state.range(0);
+  long n = state.thread_index();
+  my_Quote quote = {};
+  for (auto _ : state) {
+    if (0 == ++n % write_every) {
+      ++quote.d_timestamp;
+      lock.store(quote);
+    } else {
+      benchmark::DoNotOptimize(lock.load());
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+struct alignas(Platform::CACHE_LINE_SIZE) my_GuardedQuote {
+  ReaderWriterMutex d_lock;
+  my_Quote d_quote = {};
+};
+
+void BM_ReaderWriterMutex(benchmark::State& state) {
+  static my_GuardedQuote guarded;
+  const long write_every = state.range(0);
+  long n = state.thread_index();
+  for (auto _ : state) {
+    if (0 == ++n % write_every) {
+      guarded.d_lock.lock();
+      ++guarded.d_quote.d_timestamp;
+      guarded.d_lock.unlock();
+    } else {
+      guarded.d_lock.lock_shared();
+      my_Quote quote = guarded.d_quote;
+      guarded.d_lock.unlock_shared();
+      benchmark::DoNotOptimize(quote);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SeqLock)
+    ->Arg(1000000000)
+    ->Arg(1000)
+    ->Arg(10)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK(BM_ReaderWriterMutex)
+    ->Arg(1000000000)
+    ->Arg(1000)
+    ->Arg(10)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
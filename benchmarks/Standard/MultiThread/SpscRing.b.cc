@@ -0,0 +1,112 @@
+#include "llcl/Standard/MultiThread/SpscRing.h"
+
+#include <benchmark/benchmark.h>
+
+#include "llcl/Standard/MultiThread/MpmcQueue.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::MpmcQueue;
+using llcl::standard::mt::SpinUtil;
+using llcl::standard::mt::SpscRing;
+
+const int k_capacity = 1024;
+
+// Thread 0 streams values to thread 1, 'state.range(0)' at a time with
+// 'pushN' and 'popN'.
+void BM_Stream(benchmark::State& state) {
+  static SpscRing<long>* ring;
+  if (0 == state.thread_index()) {
+    ring = new SpscRing<long>(k_capacity);
+  }
+  const int batch = state.range(0);
+  long values[64] = {0};
+  for (auto _ : state) {
+    int done = 0;
+    int spins = 0;
+    while (done < batch) {
+      const int n = 0 == state.thread_index()
+                        ? ring->pushN(values + done, batch - done)
+                        : ring->popN(values + done, batch - done);
+      done += n;
+      if (0 == n) {
+        SpinUtil::pauseOrYield(&spins);
+      }
+    }
+  }
+  benchmark::DoNotOptimize(values);
+  if (0 == state.thread_index()) {
+    delete ring;
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+// The same stream through 'reserve'/'commit' and 'peek'/'consume'.
+void BM_StreamInPlace(benchmark::State& state) {
+  static SpscRing<long>* ring;
+  if (0 == state.thread_index()) {
+    ring = new SpscRing<long>(k_capacity);
+  }
+  const int batch = state.range(0);
+  long sum = 0;
+  for (auto _ : state) {
+    int done = 0;
+    int spins = 0;
+    while (done < batch) {
+      long* slots;
+      int n;
+      if (0 == state.thread_index()) {
+        n = ring->reserve(&slots, batch - done);
+        for (int i = 0; i < n; ++i) {
+          slots[i] = done + i;
+        }
+        ring->commit(n);
+      } else {
+        n = ring->peek(&slots, batch - done);
+        for (int i = 0; i < n; ++i) {
+          sum += slots[i];
+        }
+        ring->consume(n);
+      }
+      done += n;
+      if (0 == n) {
+        SpinUtil::pauseOrYield(&spins);
+      }
+    }
+  }
+  benchmark::DoNotOptimize(sum);
+  if (0 == state.thread_index()) {
+    delete ring;
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+// The baseline: one value at a time through the MPMC queue.
+void BM_StreamMpmc(benchmark::State& state) {
+  static MpmcQueue<long>* queue;
+  if (0 == state.thread_index()) {
+    queue = new MpmcQueue<long>(k_capacity);
+  }
+  long value = 0;
+  for (auto _ : state) {
+    int spins = 0;
+    while (0 != (0 == state.thread_index() ? queue->tryPush(value)
+                                           : queue->tryPop(&value))) {
+      SpinUtil::pauseOrYield(&spins);
+    }
+  }
+  benchmark::DoNotOptimize(value);
+  if (0 == state.thread_index()) {
+    delete queue;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Stream)->Arg(1)->Arg(16)->Arg(64)->Threads(2)->UseRealTime();
+BENCHMARK(BM_StreamInPlace)->Arg(16)->Arg(64)->Threads(2)->UseRealTime();
+BENCHMARK(BM_StreamMpmc)->Threads(2)->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,220 @@
+#include "llcl/Standard/MultiThread/ThreadPool.h"
+
+#include <benchmark/benchmark.h>
+#include <pthread.h>
+
+#include "llcl/Standard/MultiThread/Condition.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Condition;
+using llcl::standard::mt::Mutex;
+using llcl::standard::mt::SpinUtil;
+using llcl::standard::mt::ThreadPool;
+
+typedef ThreadPool::Task Task;
+
+// The baseline: workers sharing one FIFO queue guarded by a 'Mutex'.
+class my_SharedQueuePool {
+  Mutex d_lock;
+  Condition d_not_empty;
+  Task* d_head_p;
+  Task* d_tail_p;
+  bool d_stop;
+  pthread_t d_threads[64];
+  int d_num_threads;
+
+  static void* workerMain(void* pool);
+
+  // Return the oldest task, or 0 if there is none.  'd_lock' must be held.
+  Task* popLocked();
+
+ public:
+  explicit my_SharedQueuePool(int num_threads);
+
+  ~my_SharedQueuePool();
+
+  bool executePendingTask();
+
+  void submit(Task* task);
+};
+
+my_SharedQueuePool::my_SharedQueuePool(int num_threads)
+    : d_head_p(0), d_tail_p(0), d_stop(false), d_num_threads(num_threads) {
+  for (int i = 0; i < num_threads; ++i) {
+    pthread_create(&d_threads[i], 0, &workerMain, this);
+  }
+}
+
+my_SharedQueuePool::~my_SharedQueuePool() {
+  d_lock.lock();
+  d_stop = true;
+  d_not_empty.broadcast();
+  d_lock.unlock();
+  for (int i = 0; i < d_num_threads; ++i) {
+    pthread_join(d_threads[i], 0);
+  }
+}
+
+void* my_SharedQueuePool::workerMain(void* arg) {
+  my_SharedQueuePool* pool = static_cast<my_SharedQueuePool*>(arg);
+  pool->d_lock.lock();
+  while (true) {
+    Task* task = pool->popLocked();
+    if (task) {
+      pool->d_lock.unlock();
+      task->d_job(task->d_argument);
+      pool->d_lock.lock();
+    } else if (pool->d_stop) {
+      break;
+    } else {
+      pool->d_not_empty.wait(&pool->d_lock);
+    }
+  }
+  pool->d_lock.unlock();
+  return 0;
+}
+
+Task* my_SharedQueuePool::popLocked() {
+  Task* task = d_head_p;
+  if (task) {
+    d_head_p = task->d_next_p;
+    if (!d_head_p) {
+      d_tail_p = 0;
+    }
+  }
+  return task;
+}
+
+bool my_SharedQueuePool::executePendingTask() {
+  d_lock.lock();
+  Task* task = popLocked();
+  d_lock.unlock();
+  if (!task) {
+    return false;
+  }
+  task->d_job(task->d_argument);
+  return true;
+}
+
+void my_SharedQueuePool::submit(Task* task) {
+  task->d_next_p = 0;
+  d_lock.lock();
+  if (d_tail_p) {
+    d_tail_p->d_next_p = task;
+  } else {
+    d_head_p = task;
+  }
+  d_tail_p = task;
+  d_not_empty.signal();
+  d_lock.unlock();
+}
+
+// Run pending tasks of the specified 'pool' until the specified 'pending'
+// count drops to zero.
+template <class POOL>
+void helpUntilDone(POOL* pool, AtomicInt* pending) {
+  int spins = 0;
+  while (0 != pending->loadAcquire()) {
+    if (!pool->executePendingTask()) {
+      SpinUtil::pauseOrYield(&spins);
+    }
+  }
+}
+
+void decrement(void* pending) {
+  static_cast<AtomicInt*>(pending)->subtractAcqRel(1);
+}
+
+// Submit a batch of independent empty tasks from outside the pool and wait
+// for them: the cost of scheduling alone.
+template <class POOL>
+void BM_Throughput(benchmark::State& state) {
+  const int k_batch = 1024;
+  POOL pool(state.range(0));
+  Task* tasks = new Task[k_batch];
+  AtomicInt pending(0);
+  for (int i = 0; i < k_batch; ++i) {
+    tasks[i] = Task(&decrement, &pending);
+  }
+
+  for (auto _ : state) {
+    pending.storeRelaxed(k_batch);
+    for (int i = 0; i < k_batch; ++i) {
+      pool.submit(&tasks[i]);
+    }
+    helpUntilDone(&pool, &pending);
+  }
+  delete[] tasks;
+  state.SetItemsProcessed(state.iterations() * k_batch);
+}
+
+template <class POOL>
+struct my_Fib {
+  POOL* d_pool_p;
+  int d_n;
+  AtomicInt* d_pending_p;
+  long d_result;
+};
+
+// Compute Fibonacci numbers by spawning a task per call: the fork/join
+// pattern with the finest grain.
+template <class POOL>
+void fib(void* arg) {
+  my_Fib<POOL>* call = static_cast<my_Fib<POOL>*>(arg);
+  if (call->d_n < 2) {
+    call->d_result = call->d_n;
+  } else {
+    AtomicInt pending(2);
+    my_Fib<POOL> children[2] = {
+        {call->d_pool_p, call->d_n - 1, &pending, 0},
+        {call->d_pool_p, call->d_n - 2, &pending, 0}};
+    Task tasks[2] = {Task(&fib<POOL>, &children[0]),
+                     Task(&fib<POOL>, &children[1])};
+    call->d_pool_p->submit(&tasks[1]);
+    call->d_pool_p->submit(&tasks[0]);
+    helpUntilDone(call->d_pool_p, &pending);
+    call->d_result = children[0].d_result + children[1].d_result;
+  }
+  call->d_pending_p->subtractAcqRel(1);
+}
+
+template <class POOL>
+void BM_ForkJoin(benchmark::State& state) {
+  const int k_n = 18;  // 8361 tasks
+  POOL pool(state.range(0));
+  for (auto _ : state) {
+    AtomicInt pending(1);
+    my_Fib<POOL> call = {&pool, k_n, &pending, 0};
+    Task task(&fib<POOL>, &call);
+    pool.submit(&task);
+    helpUntilDone(&pool, &pending);
+    benchmark::DoNotOptimize(call.d_result);
+  }
+  state.SetItemsProcessed(state.iterations() * 8361);
+}
+
+BENCHMARK_TEMPLATE(BM_Throughput, ThreadPool)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, my_SharedQueuePool)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForkJoin, ThreadPool)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ForkJoin, my_SharedQueuePool)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace llcl
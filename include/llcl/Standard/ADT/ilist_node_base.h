@@ -21,6 +21,15 @@ class node_base_prevnext<NodeBase, false> {
   NodeBase* getPrev() const { return Prev; }
   NodeBase* getNext() const { return Next; }
 
+  /// Access Next atomically, for lock-free queues that link nodes through
+  /// it while other threads read it (see mt::MpscQueue).
+  void setNextRelease(NodeBase* Next) {
+    __atomic_store_n(&this->Next, Next, __ATOMIC_RELEASE);
+  }
+  NodeBase* getNextAcquire() const {
+    return __atomic_load_n(&Next, __ATOMIC_ACQUIRE);
+  }
+
   bool isKnownSentinel() const { return false; }
   void initializeSentinel() {}
 };
@@ -36,6 +45,15 @@ class node_base_prevnext<NodeBase, true> {
   NodeBase* getPrev() const { return PrevAndSentinel.getPointer(); }
   NodeBase* getNext() const { return Next; }
 
+  /// Access Next atomically, for lock-free queues that link nodes through
+  /// it while other threads read it (see mt::MpscQueue).
+  void setNextRelease(NodeBase* Next) {
+    __atomic_store_n(&this->Next, Next, __ATOMIC_RELEASE);
+  }
+  NodeBase* getNextAcquire() const {
+    return __atomic_load_n(&Next, __ATOMIC_ACQUIRE);
+  }
+
   bool isSentinel() const { return PrevAndSentinel.getInt(); }
   bool isKnownSentinel() const { return isSentinel(); }
   void initializeSentinel() { PrevAndSentinel.setInt(true); }
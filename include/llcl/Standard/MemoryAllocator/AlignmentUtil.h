@@ -0,0 +1,104 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_ALIGNMENTUTIL_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_ALIGNMENTUTIL_H
+
+#include <cstddef>
+
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Platform.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'AlignmentUtil' provides the alignment arithmetic shared by the allocators
+// that carve user blocks out of larger chunks of memory.
+struct AlignmentUtil {
+  using size_type = Types::size_type;
+
+  enum { MAX_ALIGNMENT = alignof(std::max_align_t) };
+
+  // Return the alignment required by an object of the specified positive
+  // 'size', i.e. the largest power of two dividing 'size', capped at
+  // 'MAX_ALIGNMENT'.
+  static size_type calculateAlignmentFromSize(size_type size);
+
+  // Return the smallest number of bytes that must be added to the specified
+  // 'address' to make it a multiple of the specified 'alignment'.  The
+  // behavior is undefined unless 'alignment' is a power of two.
+  static size_type calculateAlignmentOffset(const void* address,
+                                            size_type alignment);
+
+  // Return the smallest 'n' such that '2^n' is not less than the specified
+  // positive 'value'.
+  static int ceilLog2(size_type value);
+
+  // Return the largest 'n' such that '2^n' is not greater than the
+  // specified positive 'value'.
+  static int floorLog2(size_type value);
+
+  // Return the specified 'size' rounded up to a multiple of the specified
+  // 'alignment'.  The behavior is undefined unless 'alignment' is a power of
+  // two.
+  static size_type roundUp(size_type size, size_type alignment);
+
+  // Return the specified 'size' rounded up to a multiple of
+  // 'MAX_ALIGNMENT'.
+  static size_type roundUpToMaximalAlignment(size_type size);
+};
+
+inline AlignmentUtil::size_type AlignmentUtil::calculateAlignmentFromSize(
+    size_type size) {
+  LLCL_ASSERT_SAFE(0 < size);
+
+  const size_type alignment = size & (~size + 1);
+  const size_type max_alignment = static_cast<size_type>(MAX_ALIGNMENT);
+  return alignment < max_alignment ? alignment : max_alignment;
+}
+
+inline AlignmentUtil::size_type AlignmentUtil::calculateAlignmentOffset(
+    const void* address, size_type alignment) {
+  LLCL_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+
+  const Types::UintPtr value = reinterpret_cast<Types::UintPtr>(address);
+  return (alignment - (value & (alignment - 1))) & (alignment - 1);
+}
+
+inline int AlignmentUtil::ceilLog2(size_type value) {
+  LLCL_ASSERT_SAFE(0 < value);
+
+  return 1 == value ? 0 : floorLog2(value - 1) + 1;
+}
+
+inline int AlignmentUtil::floorLog2(size_type value) {
+  LLCL_ASSERT_SAFE(0 < value);
+
+#if defined(LLCL_PLATFORM_CMP_CLANG) || defined(LLCL_PLATFORM_CMP_GNU)
+  const int bits = static_cast<int>(sizeof(unsigned long long) * 8);
+  return bits - 1 - __builtin_clzll(static_cast<unsigned long long>(value));
+#else
+  int result = 0;
+  while (value >>= 1) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+inline AlignmentUtil::size_type AlignmentUtil::roundUp(size_type size,
+                                                       size_type alignment) {
+  LLCL_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+inline AlignmentUtil::size_type AlignmentUtil::roundUpToMaximalAlignment(
+    size_type size) {
+  return roundUp(size, MAX_ALIGNMENT);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_ALIGNMENTUTIL_H
@@ -0,0 +1,80 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_ALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_ALLOCATOR_H
+
+#include <cstddef>
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/DeleteHelper.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'Allocator' is the protocol through which every allocating llcl component
+// obtains memory.  Concrete allocators derive from it and implement
+// 'allocate' and 'deallocate'; clients hold an 'Allocator*' and never care
+// which strategy (heap, arena, pool, ...) sits behind it.
+class Allocator {
+ public:
+  using size_type = Types::size_type;
+
+  enum { MAX_ALIGNMENT = AlignmentUtil::MAX_ALIGNMENT };
+
+  // Destroy this allocator.
+  virtual ~Allocator();
+
+  // Return a newly allocated block of memory of (at least) the specified
+  // positive 'size' (in bytes), suitably aligned for any fundamental type.
+  // If 'size' is 0, a null pointer is returned with no other effect.
+  virtual void* allocate(size_type size) = 0;
+
+  // Return the memory block at the specified 'address' back to this
+  // allocator.  If 'address' is 0, this function has no effect.  The
+  // behavior is undefined unless 'address' was allocated using this
+  // allocator object and has not already been deallocated.
+  virtual void deallocate(void* address) = 0;
+
+  // Destroy the specified 'object' based on its dynamic type and then use
+  // this allocator to deallocate its memory footprint.  Do nothing if
+  // 'object' is a null pointer.
+  template <class Type>
+  void deleteObject(const Type* object);
+
+  // Destroy the specified 'object' based on its dynamic type and then use
+  // this allocator to deallocate its memory footprint.  The behavior is
+  // undefined if 'object' is a null pointer.
+  template <class Type>
+  void deleteObjectRaw(const Type* object);
+};
+
+template <class Type>
+inline void Allocator::deleteObject(const Type* object) {
+  DeleteHelper::DeleteObject(object, this);
+}
+
+template <class Type>
+inline void Allocator::deleteObjectRaw(const Type* object) {
+  DeleteHelper::DeleteObjectRow(object, this);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+// Allocate memory of the specified 'size' from the specified 'allocator',
+// so that objects can be created with 'new (allocator) Type(...)'.
+inline void* operator new(std::size_t size,
+                          llcl::standard::ma::Allocator& allocator) {
+  return allocator.allocate(size);
+}
+
+// Return the memory at the specified 'address' to the specified 'allocator'.
+// Only invoked by the compiler if the constructor of a placement-new
+// expression above throws.
+inline void operator delete(void* address,
+                            llcl::standard::ma::Allocator& allocator) {
+  allocator.deallocate(address);
+}
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_ALLOCATOR_H
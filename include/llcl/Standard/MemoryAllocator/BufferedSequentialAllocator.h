@@ -0,0 +1,80 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_BUFFEREDSEQUENTIALALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_BUFFEREDSEQUENTIALALLOCATOR_H
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MemoryAllocator/SequentialAllocator.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'BufferedSequentialAllocator' is a 'SequentialAllocator' that carries its
+// first 'BufferSize' bytes inline.  Created as a local variable, it serves
+// small temporary collections entirely from the stack and only reaches the
+// upstream allocator once the buffer is exhausted:
+//
+//   BufferedSequentialAllocator<512> allocator;
+//   Widget* w = new (allocator) Widget(...);  // no heap allocation
+//
+// This class is not thread-safe.
+template <Types::size_type BufferSize>
+class BufferedSequentialAllocator : public Allocator {
+  static_assert(0 < BufferSize, "the buffer must not be empty");
+
+  alignas(AlignmentUtil::MAX_ALIGNMENT) char d_buffer[BufferSize];
+  SequentialAllocator d_allocator;
+
+  BufferedSequentialAllocator(const BufferedSequentialAllocator&);
+  BufferedSequentialAllocator& operator=(const BufferedSequentialAllocator&);
+
+ public:
+  // Create a buffered allocator that falls back to the optionally specified
+  // 'basic_allocator' (the default allocator if 0).
+  explicit BufferedSequentialAllocator(Allocator* basic_allocator = 0);
+
+  // Destroy this allocator, returning any memory obtained from the upstream
+  // allocator.
+  ~BufferedSequentialAllocator() override;
+
+  // Return a block of the specified 'size' bytes, naturally aligned for an
+  // object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // This method has no effect; memory is reclaimed by 'release'.
+  void deallocate(void* address) override;
+
+  // Return all memory obtained from the upstream allocator and start over
+  // at the beginning of the inline buffer.
+  void release();
+};
+
+template <Types::size_type BufferSize>
+inline BufferedSequentialAllocator<BufferSize>::BufferedSequentialAllocator(
+    Allocator* basic_allocator)
+    : d_allocator(d_buffer, BufferSize, basic_allocator) {}
+
+template <Types::size_type BufferSize>
+inline BufferedSequentialAllocator<
+    BufferSize>::~BufferedSequentialAllocator() {}
+
+template <Types::size_type BufferSize>
+inline void* BufferedSequentialAllocator<BufferSize>::allocate(
+    size_type size) {
+  return d_allocator.allocate(size);
+}
+
+template <Types::size_type BufferSize>
+inline void BufferedSequentialAllocator<BufferSize>::deallocate(void*) {}
+
+template <Types::size_type BufferSize>
+inline void BufferedSequentialAllocator<BufferSize>::release() {
+  d_allocator.release();
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_BUFFEREDSEQUENTIALALLOCATOR_H
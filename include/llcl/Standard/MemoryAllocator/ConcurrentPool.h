@@ -0,0 +1,192 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_CONCURRENTPOOL_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_CONCURRENTPOOL_H
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Platform.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'ConcurrentPool' is the thread-safe counterpart of 'Pool': it dispenses
+// fixed-size blocks from a free list that is a lock-free Treiber stack, so
+// any number of threads can allocate and deallocate concurrently without a
+// mutex.  In the uncontended case 'allocate' and 'deallocate' are a single
+// compare-and-swap.  Only replenishing the free list from the upstream
+// allocator takes a mutex.
+//
+// A plain pointer compare-and-swap on the stack head is not safe against
+// the ABA problem: between reading the head and its successor, another
+// thread may pop both and push the head back.  The head is therefore an
+// 'AtomicUint64' holding the pointer together with a version tag that is
+// bumped on every change, so a stale compare always fails.  On 64-bit
+// platforms the tag lives in the top 16 bits, which requires user-space
+// addresses to fit in 48 bits (true for x86-64 with 4-level paging and for
+// AArch64 with 48-bit virtual addresses); on 32-bit platforms it has 32
+// bits of its own.
+//
+// Blocks are only returned to the upstream allocator by 'release' or on
+// destruction, which is what makes reading the successor of a possibly
+// already popped block safe.
+class ConcurrentPool {
+ public:
+  using size_type = Types::size_type;
+
+  enum { MAX_BLOCKS_PER_CHUNK = 256 };
+
+ private:
+  // The successor is read by 'allocate' while another thread may already
+  // own the block and be pushing it back, hence the atomic access.
+  struct Link {
+    AtomicPointer<Link> d_next;
+  };
+
+  struct Chunk {
+    Chunk* d_next_p;
+  };
+
+#ifdef LLCL_PLATFORM_CPU_64_BIT
+  enum { TAG_SHIFT = 48 };
+#else
+  enum { TAG_SHIFT = 32 };
+#endif
+
+  static constexpr Types::Uint64 k_pointer_mask =
+      (static_cast<Types::Uint64>(1) << TAG_SHIFT) - 1;
+
+  // Keep the contended head on a cache line of its own.
+  AtomicUint64 d_head;
+  char d_head_pad[mt::Platform::CACHE_LINE_SIZE - sizeof(AtomicUint64)];
+
+  mt::Mutex d_chunk_lock;  // serializes the fields below
+  Chunk* d_chunks_p;
+  size_type d_block_size;
+  size_type d_blocks_per_chunk;
+  size_type d_max_blocks_per_chunk;
+  Allocator* d_allocator_p;
+
+  ConcurrentPool(const ConcurrentPool&);
+  ConcurrentPool& operator=(const ConcurrentPool&);
+
+  static Link* pointer(Types::Uint64 head);
+
+  // Return the specified 'link' packed with the tag of the specified
+  // 'head' advanced by one.
+  static Types::Uint64 nextHead(Link* link, Types::Uint64 head);
+
+  // Push the list from the specified 'first' to the specified 'last' link
+  // onto the free list.
+  void pushList(Link* first, Link* last);
+
+  // Obtain a chunk of the specified 'num_blocks' blocks from the upstream
+  // allocator and push all of its blocks onto the free list.  The caller
+  // must hold 'd_chunk_lock'.
+  void addChunkLocked(size_type num_blocks);
+
+  // Add a chunk of blocks unless another thread already did.
+  void replenish();
+
+ public:
+  // Create a pool handing out blocks of the specified 'block_size' bytes,
+  // obtaining chunks from the optionally specified 'basic_allocator' (the
+  // default allocator if 0).  'basic_allocator' need not be thread-safe.
+  // The behavior is undefined unless '0 < block_size'.
+  explicit ConcurrentPool(size_type block_size,
+                          Allocator* basic_allocator = 0);
+
+  // Create a pool whose chunks never hold more than the specified
+  // 'max_blocks_per_chunk' blocks.
+  ConcurrentPool(size_type block_size, size_type max_blocks_per_chunk,
+                 Allocator* basic_allocator = 0);
+
+  // Destroy this pool, returning every chunk to the upstream allocator.
+  ~ConcurrentPool();
+
+  // Return a block of 'blockSize()' bytes, naturally aligned for an object
+  // of that size.  This function is thread-safe.
+  void* allocate();
+
+  // Return the block at the specified 'address' to this pool.  If 'address'
+  // is 0 this function has no effect.  This function is thread-safe.
+  void deallocate(void* address);
+
+  // Add a chunk of the specified 'num_blocks' blocks to the free list.
+  // This function is thread-safe.
+  void reserve(size_type num_blocks);
+
+  // Return every chunk to the upstream allocator.  All blocks handed out by
+  // this pool become invalid.  The behavior is undefined if other threads
+  // use this pool concurrently.
+  void release();
+
+  // Return the size (in bytes) of the blocks dispensed by this pool.
+  size_type blockSize() const;
+};
+
+inline ConcurrentPool::Link* ConcurrentPool::pointer(Types::Uint64 head) {
+  return reinterpret_cast<Link*>(static_cast<Types::UintPtr>(head &
+                                                             k_pointer_mask));
+}
+
+inline Types::Uint64 ConcurrentPool::nextHead(Link* link,
+                                              Types::Uint64 head) {
+  const Types::Uint64 value = reinterpret_cast<Types::UintPtr>(link);
+  LLCL_ASSERT_SAFE(0 == (value & ~k_pointer_mask));
+
+  return (((head >> TAG_SHIFT) + 1) << TAG_SHIFT) | value;
+}
+
+inline void* ConcurrentPool::allocate() {
+  Types::Uint64 head = d_head.loadAcquire();
+  for (;;) {
+    Link* link = pointer(head);
+    if (!link) {
+      replenish();
+      head = d_head.loadAcquire();
+      continue;
+    }
+
+    const Types::Uint64 new_head = nextHead(link->d_next.loadRelaxed(), head);
+    const Types::Uint64 prev = d_head.testAndSwapAcqRel(head, new_head);
+    if (prev == head) {
+      return link;
+    }
+    head = prev;
+  }
+}
+
+inline void ConcurrentPool::deallocate(void* address) {
+  if (!address) {
+    return;
+  }
+
+  Link* link = static_cast<Link*>(address);
+  pushList(link, link);
+}
+
+inline void ConcurrentPool::pushList(Link* first, Link* last) {
+  Types::Uint64 head = d_head.loadAcquire();
+  for (;;) {
+    last->d_next.storeRelaxed(pointer(head));
+    const Types::Uint64 prev =
+        d_head.testAndSwapAcqRel(head, nextHead(first, head));
+    if (prev == head) {
+      return;
+    }
+    head = prev;
+  }
+}
+
+inline ConcurrentPool::size_type ConcurrentPool::blockSize() const {
+  return d_block_size;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_CONCURRENTPOOL_H
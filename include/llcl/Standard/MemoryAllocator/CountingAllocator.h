@@ -0,0 +1,325 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_COUNTINGALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_COUNTINGALLOCATOR_H
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'CountingAllocator' is an 'Allocator' adaptor that forwards every request to
+// an upstream allocator and records what went through it: the bytes and
+// blocks currently in use, the peak bytes in use, the total number of
+// allocations and deallocations, and a histogram of the requested sizes
+// bucketed by powers of two.  All counters are 'AtomicInt64's updated with
+// relaxed ordering, so the adaptor is as thread-safe as its upstream
+// allocator and cheap enough to stay enabled in production.
+//
+// Every block carries a 'HEADER_SIZE' header recording its size and tag, so
+// 'deallocate' can keep the counters exact.
+//
+// Allocations can additionally be attributed to a call site by passing a
+// 'CountingAllocator::Tag', typically a function-local static, to
+// 'allocate', or by handing a 'TaggedAllocator' to a container:
+//
+//   static CountingAllocator::Tag tag("OrderBook::match");
+//   TaggedAllocator allocator(&counting_allocator, &tag);
+class CountingAllocator : public Allocator {
+ public:
+  enum {
+    // Bucket 'i' counts requests of '(2^(i-1), 2^i]' bytes; the last bucket
+    // also counts everything larger.
+    NUM_SIZE_BUCKETS = 24,
+    HEADER_SIZE = AlignmentUtil::MAX_ALIGNMENT
+  };
+
+  // Per-call-site counters.  A tag must outlive every block allocated with
+  // it.
+  class Tag {
+    friend class CountingAllocator;
+
+    const char* d_name_p;
+    AtomicInt64 d_num_allocations;
+    AtomicInt64 d_bytes_allocated;
+    AtomicInt64 d_bytes_in_use;
+
+    Tag(const Tag&);
+    Tag& operator=(const Tag&);
+
+   public:
+    // Create a tag with the specified 'name', which must outlive the tag.
+    explicit Tag(const char* name);
+
+    // Return the name of this tag.
+    const char* name() const;
+
+    // Return the number of allocations made with this tag.
+    Types::Int64 numAllocations() const;
+
+    // Return the total number of bytes ever allocated with this tag.
+    Types::Int64 bytesAllocated() const;
+
+    // Return the number of bytes allocated with this tag and not yet
+    // deallocated.
+    Types::Int64 bytesInUse() const;
+  };
+
+ private:
+  struct Header {
+    size_type d_size;
+    Tag* d_tag_p;
+  };
+
+  static_assert(sizeof(Header) <= HEADER_SIZE,
+                "the header must fit in front of the user area");
+
+  const char* d_name_p;
+  AtomicInt64 d_bytes_in_use;
+  AtomicInt64 d_peak_bytes_in_use;
+  AtomicInt64 d_blocks_in_use;
+  AtomicInt64 d_num_allocations;
+  AtomicInt64 d_num_deallocations;
+  AtomicInt64 d_bytes_allocated;
+  AtomicInt64 d_histogram[NUM_SIZE_BUCKETS];
+  Allocator* d_allocator_p;
+
+  CountingAllocator(const CountingAllocator&);
+  CountingAllocator& operator=(const CountingAllocator&);
+
+  // Raise the peak to the specified 'bytes_in_use' if it is higher.
+  void updatePeak(Types::Int64 bytes_in_use);
+
+ public:
+  // Create a counting allocator forwarding to the optionally specified
+  // 'basic_allocator' (the default allocator if 0).
+  explicit CountingAllocator(Allocator* basic_allocator = 0);
+
+  // Create a counting allocator with the specified 'name', which must
+  // outlive this object.
+  explicit CountingAllocator(const char* name, Allocator* basic_allocator = 0);
+
+  // Destroy this allocator.  The behavior is undefined unless every block
+  // allocated from it has been deallocated.
+  ~CountingAllocator() override;
+
+  // Return a block of at least the specified 'size' bytes, suitably aligned
+  // for any object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // Return a block of the specified 'size' bytes and also charge it to the
+  // optionally specified 'tag'.
+  void* allocate(size_type size, Tag* tag);
+
+  // Return the block at the specified 'address' to the upstream allocator.
+  // If 'address' is 0 this function has no effect.
+  void deallocate(void* address) override;
+
+  // Reset the peak to the current number of bytes in use.
+  void resetPeak();
+
+  // Return the index of the histogram bucket counting requests of the
+  // specified 'size' bytes.
+  static int bucketIndex(size_type size);
+
+  // Return the name of this allocator, or 0 if it has none.
+  const char* name() const;
+
+  // Return the number of bytes allocated and not yet deallocated.
+  Types::Int64 bytesInUse() const;
+
+  // Return the highest value of 'bytesInUse()' since construction or the
+  // last call to 'resetPeak'.
+  Types::Int64 peakBytesInUse() const;
+
+  // Return the number of blocks allocated and not yet deallocated.
+  Types::Int64 blocksInUse() const;
+
+  // Return the number of allocations.
+  Types::Int64 numAllocations() const;
+
+  // Return the number of deallocations.
+  Types::Int64 numDeallocations() const;
+
+  // Return the total number of bytes ever allocated.
+  Types::Int64 bytesAllocated() const;
+
+  // Return the number of requests counted by the histogram bucket at the
+  // specified 'index'.  The behavior is undefined unless
+  // '0 <= index < NUM_SIZE_BUCKETS'.
+  Types::Int64 numAllocationsInBucket(int index) const;
+
+  // Return the address of the upstream allocator.
+  Allocator* allocator() const;
+};
+
+// 'TaggedAllocator' charges everything it allocates to one
+// 'CountingAllocator::Tag', so that a tag can be attached to a container or
+// any other code taking an 'Allocator*'.
+class TaggedAllocator : public Allocator {
+  CountingAllocator* d_counting_allocator_p;
+  CountingAllocator::Tag* d_tag_p;
+
+  TaggedAllocator(const TaggedAllocator&);
+  TaggedAllocator& operator=(const TaggedAllocator&);
+
+ public:
+  // Create an allocator forwarding to the specified 'counting_allocator' and
+  // charging the specified 'tag'.
+  TaggedAllocator(CountingAllocator* counting_allocator,
+                  CountingAllocator::Tag* tag);
+
+  ~TaggedAllocator() override;
+
+  void* allocate(size_type size) override;
+
+  void deallocate(void* address) override;
+};
+
+inline CountingAllocator::Tag::Tag(const char* name) : d_name_p(name) {}
+
+inline const char* CountingAllocator::Tag::name() const { return d_name_p; }
+
+inline Types::Int64 CountingAllocator::Tag::numAllocations() const {
+  return d_num_allocations.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::Tag::bytesAllocated() const {
+  return d_bytes_allocated.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::Tag::bytesInUse() const {
+  return d_bytes_in_use.loadRelaxed();
+}
+
+inline int CountingAllocator::bucketIndex(size_type size) {
+  if (size <= 1) {
+    return 0;
+  }
+
+  const int index = AlignmentUtil::ceilLog2(size);
+  return index < NUM_SIZE_BUCKETS ? index : NUM_SIZE_BUCKETS - 1;
+}
+
+inline void* CountingAllocator::allocate(size_type size) {
+  return allocate(size, 0);
+}
+
+inline void* CountingAllocator::allocate(size_type size, Tag* tag) {
+  if (0 == size) {
+    return 0;
+  }
+
+  char* block =
+      static_cast<char*>(d_allocator_p->allocate(HEADER_SIZE + size));
+  Header* header = reinterpret_cast<Header*>(block);
+  header->d_size = size;
+  header->d_tag_p = tag;
+
+  const Types::Int64 bytes = static_cast<Types::Int64>(size);
+  d_num_allocations.addRelaxed(1);
+  d_blocks_in_use.addRelaxed(1);
+  d_bytes_allocated.addRelaxed(bytes);
+  d_histogram[bucketIndex(size)].addRelaxed(1);
+  updatePeak(d_bytes_in_use.addRelaxed(bytes));
+
+  if (tag) {
+    tag->d_num_allocations.addRelaxed(1);
+    tag->d_bytes_allocated.addRelaxed(bytes);
+    tag->d_bytes_in_use.addRelaxed(bytes);
+  }
+
+  return block + HEADER_SIZE;
+}
+
+inline void CountingAllocator::deallocate(void* address) {
+  if (!address) {
+    return;
+  }
+
+  char* block = static_cast<char*>(address) - HEADER_SIZE;
+  const Header* header = reinterpret_cast<const Header*>(block);
+  const Types::Int64 bytes = static_cast<Types::Int64>(header->d_size);
+
+  d_num_deallocations.addRelaxed(1);
+  d_blocks_in_use.subtractRelaxed(1);
+  d_bytes_in_use.subtractRelaxed(bytes);
+  if (header->d_tag_p) {
+    header->d_tag_p->d_bytes_in_use.subtractRelaxed(bytes);
+  }
+
+  d_allocator_p->deallocate(block);
+}
+
+inline void CountingAllocator::updatePeak(Types::Int64 bytes_in_use) {
+  // Only a new high-water mark costs a compare-and-swap.
+  Types::Int64 peak = d_peak_bytes_in_use.loadRelaxed();
+  while (bytes_in_use > peak) {
+    const Types::Int64 prev =
+        d_peak_bytes_in_use.testAndSwap(peak, bytes_in_use);
+    if (prev == peak) {
+      return;
+    }
+    peak = prev;
+  }
+}
+
+inline const char* CountingAllocator::name() const { return d_name_p; }
+
+inline Types::Int64 CountingAllocator::bytesInUse() const {
+  return d_bytes_in_use.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::peakBytesInUse() const {
+  return d_peak_bytes_in_use.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::blocksInUse() const {
+  return d_blocks_in_use.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::numAllocations() const {
+  return d_num_allocations.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::numDeallocations() const {
+  return d_num_deallocations.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::bytesAllocated() const {
+  return d_bytes_allocated.loadRelaxed();
+}
+
+inline Types::Int64 CountingAllocator::numAllocationsInBucket(
+    int index) const {
+  LLCL_ASSERT_SAFE(0 <= index && index < NUM_SIZE_BUCKETS);
+
+  return d_histogram[index].loadRelaxed();
+}
+
+inline Allocator* CountingAllocator::allocator() const {
+  return d_allocator_p;
+}
+
+inline TaggedAllocator::TaggedAllocator(CountingAllocator* counting_allocator,
+                                        CountingAllocator::Tag* tag)
+    : d_counting_allocator_p(counting_allocator), d_tag_p(tag) {
+  LLCL_ASSERT_SAFE(counting_allocator);
+}
+
+inline void* TaggedAllocator::allocate(size_type size) {
+  return d_counting_allocator_p->allocate(size, d_tag_p);
+}
+
+inline void TaggedAllocator::deallocate(void* address) {
+  d_counting_allocator_p->deallocate(address);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_COUNTINGALLOCATOR_H
@@ -0,0 +1,41 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_DEFAULT_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_DEFAULT_H
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'Default' holds the process-wide default allocator.  Components that take
+// an optional 'Allocator*' resolve it through 'Default::allocator', so a
+// null argument means "use whatever the process installed", which is the
+// 'NewDeleteAllocator' singleton unless 'setDefaultAllocator' was called.
+class Default {
+  static AtomicPointer<Allocator> s_default_allocator;
+
+ public:
+  // Return the address of the process-wide default allocator.
+  static Allocator* defaultAllocator();
+
+  // Install the specified 'basic_allocator' as the process-wide default
+  // allocator.  If 'basic_allocator' is 0, reinstall the
+  // 'NewDeleteAllocator' singleton.  This is intended to be called once,
+  // early in 'main', before any component captures the default.
+  static void setDefaultAllocator(Allocator* basic_allocator);
+
+  // Return the specified 'basic_allocator' if it is not 0, and the
+  // process-wide default allocator otherwise.
+  static Allocator* allocator(Allocator* basic_allocator = 0);
+};
+
+inline Allocator* Default::allocator(Allocator* basic_allocator) {
+  return basic_allocator ? basic_allocator : defaultAllocator();
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_DEFAULT_H
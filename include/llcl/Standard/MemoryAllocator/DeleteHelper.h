@@ -1,16 +1,24 @@
 #ifndef LLCL_STANDARD_MEMORYALLOCATOR_DELETEHELPER_H
 #define LLCL_STANDARD_MEMORYALLOCATOR_DELETEHELPER_H
 
-namespace llcl {
-
-namespace Standard {
+#include "llcl/Standard/MetaFunctions/IsPolymorphic.h"
+#include "llcl/Standard/System/Assert.h"
 
-namespace MemoryAllocator {
+namespace llcl {
+namespace standard {
+namespace ma {
 
 struct DeleteHelper {
+  // Destroy the specified 'obj' based on its dynamic type and then use the
+  // specified 'alloc' to deallocate its memory footprint.  Do nothing if
+  // 'obj' is a null pointer.  'Allocator' must provide a 'deallocate(void*)'
+  // member function.
   template <class Type, class Allocator>
   static void DeleteObject(const Type* obj, Allocator* alloc);
 
+  // Destroy the specified 'obj' based on its dynamic type and then use the
+  // specified 'alloc' to deallocate its memory footprint.  The behavior is
+  // undefined if 'obj' is a null pointer.
   template <class Type, class Allocator>
   static void DeleteObjectRow(const Type* obj, Allocator* alloc);
 };
@@ -23,11 +31,37 @@ struct DeleteHelperHelper {
   }
 };
 
-}  // namespace MemoryAllocator
+// A pointer to a polymorphic base may not address the start of the block
+// that was allocated for the complete object, so ask for the most-derived
+// address instead.
+template <>
+struct DeleteHelperHelper<true> {
+  template <class Type>
+  static void* caster(const Type* object) {
+    return const_cast<void*>(dynamic_cast<const volatile void*>(object));
+  }
+};
 
-}  // namespace Standard
+template <class Type, class Allocator>
+inline void DeleteHelper::DeleteObject(const Type* obj, Allocator* alloc) {
+  if (0 != obj) {
+    DeleteObjectRow(obj, alloc);
+  }
+}
 
-}  // namespace llcl
+template <class Type, class Allocator>
+inline void DeleteHelper::DeleteObjectRow(const Type* obj, Allocator* alloc) {
+  LLCL_ASSERT_SAFE(obj);
+  LLCL_ASSERT_SAFE(alloc);
 
+  void* address =
+      DeleteHelperHelper<mf::IsPolymorphic<Type>::value>::caster(obj);
+  obj->~Type();
+  alloc->deallocate(address);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
 
-#endif  // LLCL_STANDARD_MEMORYALLOCATOR_DELETEHELPER_H
\ No newline at end of file
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_DELETEHELPER_H
@@ -0,0 +1,154 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_HUGEPAGEARENA_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_HUGEPAGEARENA_H
+
+#include "llcl/Standard/System/Platform.h"
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'HugePageArena' is a monotonic (bump-pointer) arena whose chunks are
+// mapped directly with 'mmap' and, where the platform supports it
+// ('LLCL_PLATFORM_OS_HUGE_PAGES'), backed by huge pages to cut the TLB
+// misses of large in-memory data structures.  Each chunk is obtained with the
+// first of these that succeeds:
+//
+//  1. an explicit huge page mapping ('MAP_HUGETLB'), which needs huge pages
+//     reserved by the administrator ('vm.nr_hugepages');
+//  2. a 'HUGE_PAGE_SIZE'-aligned normal mapping advised with
+//     'madvise(MADV_HUGEPAGE)' for transparent huge pages;
+//  3. a normal mapping.
+//
+// With 'PREFAULT' every page of a chunk is faulted in when the chunk is
+// mapped, and with 'LOCK' it is also locked in memory with 'mlock', so that
+// calling 'reserve' ahead of time (e.g. before the trading session opens)
+// takes all page faults off the critical path.  Locking is best effort: it
+// fails silently if 'RLIMIT_MEMLOCK' is too low, which 'bytesLocked' shows.
+//
+// 'deallocate' does nothing: all memory is unmapped at once by 'release' or
+// on destruction.  Throws 'std::bad_alloc' if no mapping can be obtained.
+//
+// This class is not thread-safe.
+class HugePageArena : public Allocator {
+ public:
+  enum PageKind {
+    EXPLICIT_HUGE_PAGES,
+    TRANSPARENT_HUGE_PAGES,
+    NORMAL_PAGES,
+    NUM_PAGE_KINDS
+  };
+
+  enum Flags { PREFAULT = 1 << 0, LOCK = 1 << 1 };
+
+  // The default huge page size on x86-64 and most AArch64 kernels.
+  enum { HUGE_PAGE_SIZE = 1 << 21, DEFAULT_CHUNK_SIZE = 1 << 25 };
+
+ private:
+  struct Chunk {
+    Chunk* d_next_p;
+    size_type d_size;
+  };
+
+  char* d_cursor_p;
+  char* d_end_p;
+  Chunk* d_chunks_p;
+  size_type d_chunk_size;
+  int d_flags;
+  size_type d_bytes_mapped[NUM_PAGE_KINDS];
+  size_type d_bytes_locked;
+
+  HugePageArena(const HugePageArena&);
+  HugePageArena& operator=(const HugePageArena&);
+
+  // Map a chunk of at least the specified 'size' bytes and make it current.
+  void addChunk(size_type size);
+
+  // Obtain a new chunk large enough for the specified 'size' bytes and
+  // return the first 'size' bytes of it.
+  void* allocateFromNewChunk(size_type size);
+
+ public:
+  // Create an arena mapping chunks of the optionally specified 'chunk_size'
+  // bytes, rounded up to a multiple of 'HUGE_PAGE_SIZE', with the
+  // optionally specified 'flags' (a combination of 'Flags').  No memory is
+  // mapped until the first request.
+  explicit HugePageArena(size_type chunk_size = DEFAULT_CHUNK_SIZE,
+                         int flags = 0);
+
+  // Destroy this arena, unmapping every chunk.
+  ~HugePageArena() override;
+
+  // Return a block of the specified 'size' bytes, naturally aligned for an
+  // object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // This method has no effect; memory is reclaimed by 'release'.
+  void deallocate(void* address) override;
+
+  // Make sure the next requests totalling the specified 'num_bytes' bytes
+  // (plus alignment padding) are served without mapping a new chunk, mapping
+  // (and, depending on the flags, prefaulting and locking) one now if
+  // needed.  Whatever is left of the current chunk is then abandoned.
+  void reserve(size_type num_bytes);
+
+  // Unmap every chunk.  All memory handed out by this arena becomes
+  // invalid.
+  void release();
+
+  // Return the number of bytes currently mapped with the specified 'kind'
+  // of pages.
+  size_type bytesMapped(PageKind kind) const;
+
+  // Return the number of bytes currently locked in memory.
+  size_type bytesLocked() const;
+
+  // Return the size of the chunks mapped by this arena.
+  size_type chunkSize() const;
+};
+
+inline void* HugePageArena::allocate(size_type size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  const size_type offset = AlignmentUtil::calculateAlignmentOffset(
+      d_cursor_p, AlignmentUtil::calculateAlignmentFromSize(size));
+
+  if (size + offset <= static_cast<size_type>(d_end_p - d_cursor_p)) {
+    char* result = d_cursor_p + offset;
+    d_cursor_p = result + size;
+    return result;
+  }
+
+  return allocateFromNewChunk(size);
+}
+
+inline void HugePageArena::deallocate(void*) {}
+
+inline HugePageArena::size_type HugePageArena::bytesMapped(
+    PageKind kind) const {
+  LLCL_ASSERT_SAFE(0 <= kind && kind < NUM_PAGE_KINDS);
+
+  return d_bytes_mapped[kind];
+}
+
+inline HugePageArena::size_type HugePageArena::bytesLocked() const {
+  return d_bytes_locked;
+}
+
+inline HugePageArena::size_type HugePageArena::chunkSize() const {
+  return d_chunk_size;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_PLATFORM_OS_UNIX
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_HUGEPAGEARENA_H
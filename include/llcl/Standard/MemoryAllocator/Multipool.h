@@ -0,0 +1,217 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_MULTIPOOL_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_MULTIPOOL_H
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MemoryAllocator/Pool.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'Multipool' is an 'Allocator' that routes each request to one of a number
+// of 'Pool's with power-of-two block sizes ('MIN_BLOCK_SIZE',
+// '2 * MIN_BLOCK_SIZE', ...), picking the smallest one that fits.  Requests
+// larger than the biggest pool go straight to the upstream allocator.  Each
+// block carries a small header recording its pool, so 'deallocate' needs no
+// size and memory from a 'Multipool' can back any llcl container.
+//
+// Per size class the multipool keeps the number of allocations and the
+// current and peak number of blocks in use.  Index 'numPools()' of the
+// statistics accessors refers to the oversized requests.
+//
+// This class is not thread-safe.
+class Multipool : public Allocator {
+  // Stored in front of every block; padded to 'HEADER_SIZE' so that the
+  // user area stays aligned.
+  struct Header {
+    int d_pool_index;
+  };
+
+  struct SizeClass {
+    Types::Uint64 d_num_allocations;
+    Types::Uint64 d_num_in_use;
+    Types::Uint64 d_peak_in_use;
+  };
+
+  enum { OVERSIZED = -1, HEADER_SIZE = AlignmentUtil::MAX_ALIGNMENT };
+
+  Pool* d_pools_p;
+  SizeClass* d_classes_p;
+  int d_num_pools;
+  size_type d_max_pooled_size;
+  Allocator* d_allocator_p;
+
+  Multipool(const Multipool&);
+  Multipool& operator=(const Multipool&);
+
+  // Return the index of the pool serving requests of the specified 'size',
+  // or 'OVERSIZED' if 'size' is larger than 'maxPooledBlockSize()'.
+  int findPool(size_type size) const;
+
+  // Record an allocation from the specified 'size_class'.
+  static void recordAllocation(SizeClass* size_class);
+
+ public:
+  enum {
+    MIN_BLOCK_SHIFT = 3,
+    MIN_BLOCK_SIZE = 1 << MIN_BLOCK_SHIFT,
+    DEFAULT_NUM_POOLS = 7
+  };
+
+  // Create a multipool with 'DEFAULT_NUM_POOLS' pools (block sizes 8 to
+  // 512) obtaining memory from the optionally specified 'basic_allocator'
+  // (the default allocator if 0).
+  explicit Multipool(Allocator* basic_allocator = 0);
+
+  // Create a multipool with the specified 'num_pools' pools whose chunks
+  // never hold more than the specified 'max_blocks_per_chunk' blocks.  The
+  // behavior is undefined unless '0 < num_pools' and
+  // '0 < max_blocks_per_chunk'.
+  explicit Multipool(
+      int num_pools,
+      size_type max_blocks_per_chunk = Pool::MAX_BLOCKS_PER_CHUNK,
+      Allocator* basic_allocator = 0);
+
+  // Destroy this multipool, returning all memory to the upstream allocator.
+  ~Multipool() override;
+
+  // Return a block of at least the specified 'size' bytes, suitably aligned
+  // for any object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // Return the block at the specified 'address' to the pool it came from,
+  // or to the upstream allocator if it was oversized.  If 'address' is 0
+  // this function has no effect.
+  void deallocate(void* address) override;
+
+  // Make sure the next specified 'num_blocks' requests of the specified
+  // 'size' do not reach the upstream allocator.  The behavior is undefined
+  // unless '0 < size <= maxPooledBlockSize()'.
+  void reserve(size_type size, size_type num_blocks);
+
+  // Return all pooled memory to the upstream allocator.  Oversized blocks
+  // still in use are not affected.  All pooled blocks handed out by this
+  // multipool become invalid and the in-use counts are reset.
+  void release();
+
+  // Return the number of pools.
+  int numPools() const;
+
+  // Return the largest request served from a pool.
+  size_type maxPooledBlockSize() const;
+
+  // Return the largest request served by the pool at the specified
+  // 'index'.  The behavior is undefined unless '0 <= index < numPools()'.
+  size_type poolBlockSize(int index) const;
+
+  // Return the number of allocations served by the size class at the
+  // specified 'index'.  The behavior is undefined unless
+  // '0 <= index <= numPools()'.
+  Types::Uint64 numAllocations(int index) const;
+
+  // Return the number of blocks of the size class at the specified 'index'
+  // currently in use.
+  Types::Uint64 numBlocksInUse(int index) const;
+
+  // Return the largest number of blocks of the size class at the specified
+  // 'index' that were ever in use at the same time.
+  Types::Uint64 peakBlocksInUse(int index) const;
+
+  // Return the address of the upstream allocator.
+  Allocator* allocator() const;
+};
+
+inline int Multipool::findPool(size_type size) const {
+  if (size > d_max_pooled_size) {
+    return OVERSIZED;
+  }
+  if (size <= MIN_BLOCK_SIZE) {
+    return 0;
+  }
+
+  return AlignmentUtil::ceilLog2(size) - MIN_BLOCK_SHIFT;
+}
+
+inline void Multipool::recordAllocation(SizeClass* size_class) {
+  ++size_class->d_num_allocations;
+  if (++size_class->d_num_in_use > size_class->d_peak_in_use) {
+    size_class->d_peak_in_use = size_class->d_num_in_use;
+  }
+}
+
+inline void* Multipool::allocate(size_type size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  const int index = findPool(size);
+  char* block;
+  if (OVERSIZED == index) {
+    block = static_cast<char*>(d_allocator_p->allocate(HEADER_SIZE + size));
+    recordAllocation(&d_classes_p[d_num_pools]);
+  } else {
+    block = static_cast<char*>(d_pools_p[index].allocate());
+    recordAllocation(&d_classes_p[index]);
+  }
+
+  reinterpret_cast<Header*>(block)->d_pool_index = index;
+  return block + HEADER_SIZE;
+}
+
+inline void Multipool::deallocate(void* address) {
+  if (!address) {
+    return;
+  }
+
+  char* block = static_cast<char*>(address) - HEADER_SIZE;
+  const int index = reinterpret_cast<Header*>(block)->d_pool_index;
+  if (OVERSIZED == index) {
+    --d_classes_p[d_num_pools].d_num_in_use;
+    d_allocator_p->deallocate(block);
+  } else {
+    LLCL_ASSERT_SAFE(0 <= index && index < d_num_pools);
+
+    --d_classes_p[index].d_num_in_use;
+    d_pools_p[index].deallocate(block);
+  }
+}
+
+inline int Multipool::numPools() const { return d_num_pools; }
+
+inline Multipool::size_type Multipool::maxPooledBlockSize() const {
+  return d_max_pooled_size;
+}
+
+inline Multipool::size_type Multipool::poolBlockSize(int index) const {
+  LLCL_ASSERT_SAFE(0 <= index && index < d_num_pools);
+
+  return static_cast<size_type>(MIN_BLOCK_SIZE) << index;
+}
+
+inline Types::Uint64 Multipool::numAllocations(int index) const {
+  LLCL_ASSERT_SAFE(0 <= index && index <= d_num_pools);
+
+  return d_classes_p[index].d_num_allocations;
+}
+
+inline Types::Uint64 Multipool::numBlocksInUse(int index) const {
+  LLCL_ASSERT_SAFE(0 <= index && index <= d_num_pools);
+
+  return d_classes_p[index].d_num_in_use;
+}
+
+inline Types::Uint64 Multipool::peakBlocksInUse(int index) const {
+  LLCL_ASSERT_SAFE(0 <= index && index <= d_num_pools);
+
+  return d_classes_p[index].d_peak_in_use;
+}
+
+inline Allocator* Multipool::allocator() const { return d_allocator_p; }
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_MULTIPOOL_H
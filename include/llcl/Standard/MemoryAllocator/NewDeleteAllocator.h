@@ -0,0 +1,36 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_NEWDELETEALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_NEWDELETEALLOCATOR_H
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'NewDeleteAllocator' is the stateless 'Allocator' that forwards every
+// request to the global 'operator new' and 'operator delete'.  It is the
+// allocator used when nothing else has been installed as the default.
+class NewDeleteAllocator : public Allocator {
+  NewDeleteAllocator(const NewDeleteAllocator&);
+  NewDeleteAllocator& operator=(const NewDeleteAllocator&);
+
+ public:
+  // Return a reference to the process-wide instance of this allocator.
+  static NewDeleteAllocator& singleton();
+
+  NewDeleteAllocator();
+
+  ~NewDeleteAllocator() override;
+
+  void* allocate(size_type size) override;
+
+  void deallocate(void* address) override;
+};
+
+inline NewDeleteAllocator::NewDeleteAllocator() {}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_NEWDELETEALLOCATOR_H
@@ -0,0 +1,97 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_NODEPOOL_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_NODEPOOL_H
+
+#include <new>
+#include <utility>
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Pool.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'NodePool' is a 'Pool' whose blocks are sized and aligned for 'NodeType',
+// typically a class derived from 'ilist_node_base<...>'.  It creates and
+// destroys nodes in place, so an intrusive list of millions of nodes costs
+// no per-node heap overhead and keeps its nodes packed in a few chunks.
+//
+// This class is not thread-safe.
+template <class NodeType>
+class NodePool {
+  static_assert(alignof(NodeType) <= AlignmentUtil::MAX_ALIGNMENT,
+                "over-aligned node types are not supported");
+
+  Pool d_pool;
+
+  NodePool(const NodePool&);
+  NodePool& operator=(const NodePool&);
+
+ public:
+  using size_type = Pool::size_type;
+
+  // Create a node pool obtaining its chunks from the optionally specified
+  // 'basic_allocator' (the default allocator if 0).
+  explicit NodePool(Allocator* basic_allocator = 0);
+
+  // Create a node pool whose chunks never hold more than the specified
+  // 'max_nodes_per_chunk' nodes.
+  NodePool(size_type max_nodes_per_chunk, Allocator* basic_allocator);
+
+  // Construct a 'NodeType' from the specified 'args' in a block of this pool
+  // and return its address.
+  template <class... Args>
+  NodeType* createNode(Args&&... args);
+
+  // Destroy the specified 'node' and return its block to this pool.  If
+  // 'node' is 0 this function has no effect.
+  void deleteNode(NodeType* node);
+
+  // Make sure the next specified 'num_nodes' calls to 'createNode' do not
+  // reach the upstream allocator.
+  void reserve(size_type num_nodes);
+
+  // Return all memory to the upstream allocator without running any node
+  // destructor.  All nodes created by this pool become invalid.
+  void release();
+};
+
+template <class NodeType>
+inline NodePool<NodeType>::NodePool(Allocator* basic_allocator)
+    : d_pool(sizeof(NodeType), basic_allocator) {}
+
+template <class NodeType>
+inline NodePool<NodeType>::NodePool(size_type max_nodes_per_chunk,
+                                    Allocator* basic_allocator)
+    : d_pool(sizeof(NodeType), max_nodes_per_chunk, basic_allocator) {}
+
+template <class NodeType>
+template <class... Args>
+inline NodeType* NodePool<NodeType>::createNode(Args&&... args) {
+  void* block = d_pool.allocate();
+  return new (block) NodeType(std::forward<Args>(args)...);
+}
+
+template <class NodeType>
+inline void NodePool<NodeType>::deleteNode(NodeType* node) {
+  if (node) {
+    node->~NodeType();
+    d_pool.deallocate(node);
+  }
+}
+
+template <class NodeType>
+inline void NodePool<NodeType>::reserve(size_type num_nodes) {
+  d_pool.reserve(num_nodes);
+}
+
+template <class NodeType>
+inline void NodePool<NodeType>::release() {
+  d_pool.release();
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_NODEPOOL_H
@@ -0,0 +1,124 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_POOL_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_POOL_H
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'Pool' dispenses memory blocks of one fixed size.  Blocks are carved out of
+// chunks obtained from an upstream allocator and threaded onto an embedded
+// free list, so 'allocate' and 'deallocate' are a single pointer pop and
+// push.  Chunks hold a geometrically growing number of blocks, up to a
+// maximum, and are only returned upstream by 'release' or on destruction.
+// Keeping the blocks contiguous also improves cache locality when they are
+// traversed, e.g. as the nodes of an intrusive list.
+//
+// This class is not thread-safe.
+class Pool {
+ public:
+  using size_type = Types::size_type;
+
+  enum { MAX_BLOCKS_PER_CHUNK = 256 };
+
+ private:
+  struct Link {
+    Link* d_next_p;
+  };
+
+  struct Chunk {
+    Chunk* d_next_p;
+  };
+
+  Link* d_free_list_p;
+  Chunk* d_chunks_p;
+  size_type d_block_size;
+  size_type d_blocks_per_chunk;
+  size_type d_max_blocks_per_chunk;
+  Allocator* d_allocator_p;
+
+  Pool(const Pool&);
+  Pool& operator=(const Pool&);
+
+  // Obtain a chunk of the specified 'num_blocks' blocks from the upstream
+  // allocator and push all of its blocks onto the free list.
+  void addChunk(size_type num_blocks);
+
+  // Add a chunk of the current chunk size and grow the chunk size.
+  void replenish();
+
+ public:
+  // Create a pool handing out blocks of the specified 'block_size' bytes,
+  // obtaining chunks from the optionally specified 'basic_allocator' (the
+  // default allocator if 0).  The behavior is undefined unless
+  // '0 < block_size'.
+  explicit Pool(size_type block_size, Allocator* basic_allocator = 0);
+
+  // Create a pool handing out blocks of the specified 'block_size' bytes
+  // whose chunks never hold more than the specified 'max_blocks_per_chunk'
+  // blocks.  The behavior is undefined unless '0 < block_size' and
+  // '0 < max_blocks_per_chunk'.
+  Pool(size_type block_size, size_type max_blocks_per_chunk,
+       Allocator* basic_allocator = 0);
+
+  // Destroy this pool, returning every chunk to the upstream allocator.
+  ~Pool();
+
+  // Return a block of 'blockSize()' bytes, naturally aligned for an object
+  // of that size.
+  void* allocate();
+
+  // Return the block at the specified 'address' to this pool.  If 'address'
+  // is 0 this function has no effect.  The behavior is undefined unless
+  // 'address' was allocated from this pool and not yet deallocated.
+  void deallocate(void* address);
+
+  // Make sure at least the specified 'num_blocks' blocks are on the free
+  // list, so the next 'num_blocks' calls to 'allocate' do not reach the
+  // upstream allocator.  The memory of the new blocks is touched here, so
+  // this also prefaults it.
+  void reserve(size_type num_blocks);
+
+  // Return every chunk to the upstream allocator.  All blocks handed out by
+  // this pool become invalid.
+  void release();
+
+  // Return the size (in bytes) of the blocks dispensed by this pool; this
+  // may be larger than the size requested at construction.
+  size_type blockSize() const;
+
+  // Return the address of the upstream allocator.
+  Allocator* allocator() const;
+};
+
+inline void* Pool::allocate() {
+  if (!d_free_list_p) {
+    replenish();
+  }
+
+  Link* block = d_free_list_p;
+  d_free_list_p = block->d_next_p;
+  return block;
+}
+
+inline void Pool::deallocate(void* address) {
+  if (!address) {
+    return;
+  }
+
+  Link* block = static_cast<Link*>(address);
+  block->d_next_p = d_free_list_p;
+  d_free_list_p = block;
+}
+
+inline Pool::size_type Pool::blockSize() const { return d_block_size; }
+
+inline Allocator* Pool::allocator() const { return d_allocator_p; }
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_POOL_H
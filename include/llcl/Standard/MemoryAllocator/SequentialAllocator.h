@@ -0,0 +1,119 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_SEQUENTIALALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_SEQUENTIALALLOCATOR_H
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'SequentialAllocator' is a monotonic (bump-pointer) arena.  Each request
+// is carved from the current chunk by advancing a cursor; when the chunk is
+// exhausted a new one, twice the size of the previous one up to a maximum,
+// is obtained from the upstream allocator.  'deallocate' does nothing: all
+// memory is returned at once by 'release' or on destruction.  The arena can
+// optionally start from a caller-supplied buffer (e.g. on the stack), in
+// which case no upstream allocation happens until that buffer is used up.
+//
+// This class is not thread-safe.
+class SequentialAllocator : public Allocator {
+  struct Block {
+    Block* d_next_p;
+  };
+
+  char* d_cursor_p;
+  char* d_end_p;
+  Block* d_blocks_p;
+  char* d_buffer_p;
+  size_type d_buffer_size;
+  size_type d_initial_block_size;
+  size_type d_next_block_size;
+  size_type d_max_block_size;
+  Allocator* d_allocator_p;
+
+  SequentialAllocator(const SequentialAllocator&);
+  SequentialAllocator& operator=(const SequentialAllocator&);
+
+  // Obtain a new chunk large enough for the specified 'size' bytes from the
+  // upstream allocator and return the first 'size' bytes of it.
+  void* allocateFromNewBlock(size_type size);
+
+ public:
+  enum { INITIAL_BLOCK_SIZE = 256, MAX_BLOCK_SIZE = 1 << 20 };
+
+  // Create a sequential allocator that obtains its chunks from the
+  // optionally specified 'basic_allocator' (the default allocator if 0).
+  explicit SequentialAllocator(Allocator* basic_allocator = 0);
+
+  // Create a sequential allocator whose first chunk has the specified
+  // 'initial_block_size' and whose chunks never grow beyond the specified
+  // 'max_block_size' bytes.  Requests larger than 'max_block_size' are
+  // given a dedicated chunk.  The behavior is undefined unless
+  // '0 < initial_block_size <= max_block_size'.
+  SequentialAllocator(size_type initial_block_size, size_type max_block_size,
+                      Allocator* basic_allocator = 0);
+
+  // Create a sequential allocator that first hands out memory from the
+  // specified 'buffer' of the specified 'size' bytes and only then goes to
+  // the optionally specified 'basic_allocator'.  'buffer' must outlive
+  // this object.
+  SequentialAllocator(char* buffer, size_type size,
+                      Allocator* basic_allocator = 0);
+
+  // Destroy this allocator, returning every chunk to the upstream
+  // allocator.
+  ~SequentialAllocator() override;
+
+  // Return a block of the specified 'size' bytes, naturally aligned for an
+  // object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // This method has no effect; memory is reclaimed by 'release'.
+  void deallocate(void* address) override;
+
+  // Return every chunk obtained so far to the upstream allocator and rewind
+  // to the initial state.  All memory handed out by this allocator becomes
+  // invalid.
+  void release();
+
+  // Return the number of bytes still available in the current chunk.
+  size_type remainingInCurrentBlock() const;
+
+  // Return the address of the upstream allocator.
+  Allocator* allocator() const;
+};
+
+inline void* SequentialAllocator::allocate(size_type size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  const size_type offset = AlignmentUtil::calculateAlignmentOffset(
+      d_cursor_p, AlignmentUtil::calculateAlignmentFromSize(size));
+
+  if (size + offset <= static_cast<size_type>(d_end_p - d_cursor_p)) {
+    char* result = d_cursor_p + offset;
+    d_cursor_p = result + size;
+    return result;
+  }
+
+  return allocateFromNewBlock(size);
+}
+
+inline void SequentialAllocator::deallocate(void*) {}
+
+inline SequentialAllocator::size_type
+SequentialAllocator::remainingInCurrentBlock() const {
+  return d_end_p - d_cursor_p;
+}
+
+inline Allocator* SequentialAllocator::allocator() const {
+  return d_allocator_p;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_SEQUENTIALALLOCATOR_H
@@ -0,0 +1,203 @@
+#ifndef LLCL_STANDARD_MEMORYALLOCATOR_THREADCACHINGALLOCATOR_H
+#define LLCL_STANDARD_MEMORYALLOCATOR_THREADCACHINGALLOCATOR_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+// 'ThreadCachingAllocator' is a thread-safe 'Allocator' adaptor that puts a
+// per-thread cache in front of a shared backing allocator.  Every thread
+// keeps, for each power-of-two size class up to 'MAX_CACHED_SIZE', a
+// magazine of free blocks.  'allocate' pops from and 'deallocate' pushes to
+// the calling thread's magazine, touching no shared cache line and taking no
+// lock.  Only when a magazine runs empty (or full) are 'BATCH_SIZE' blocks
+// moved from (or to) the backing allocator, under an internal mutex, so the
+// backing allocator does not need to be thread-safe itself.  Larger requests
+// go to the backing allocator directly, also under the mutex.
+//
+// A block may be deallocated by a different thread than the one that
+// allocated it; it simply joins the deallocating thread's cache.  A thread's
+// cache is returned to the backing allocator when the thread exits.  The
+// behavior is undefined if this object is destroyed while other threads are
+// still using it.
+class ThreadCachingAllocator : public Allocator {
+ public:
+  enum {
+    MIN_BLOCK_SHIFT = 3,
+    NUM_SIZE_CLASSES = 7,
+    MAX_CACHED_SIZE = 1 << (MIN_BLOCK_SHIFT + NUM_SIZE_CLASSES - 1),
+    MAGAZINE_CAPACITY = 64,
+    BATCH_SIZE = 32
+  };
+
+ private:
+  // Stored in front of every block; padded to 'HEADER_SIZE' so that the
+  // user area stays aligned.
+  struct Header {
+    int d_size_class;
+  };
+
+  enum { OVERSIZED = -1, HEADER_SIZE = AlignmentUtil::MAX_ALIGNMENT };
+
+  struct Magazine {
+    int d_count;
+    void* d_blocks[MAGAZINE_CAPACITY];
+  };
+
+  struct ThreadCache {
+    ThreadCachingAllocator* d_owner_p;
+    ThreadCache* d_prev_p;
+    ThreadCache* d_next_p;
+    Magazine d_magazines[NUM_SIZE_CLASSES];
+  };
+
+  pthread_key_t d_key;
+  mt::Mutex d_lock;  // serializes 'd_backing_p' and 'd_caches_p'
+  ThreadCache* d_caches_p;
+  Allocator* d_backing_p;
+
+  ThreadCachingAllocator(const ThreadCachingAllocator&);
+  ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+  // Return the size class serving requests of the specified 'size', or
+  // 'OVERSIZED'.
+  static int findSizeClass(size_type size);
+
+  // Return the block size of the specified 'size_class'.
+  static size_type sizeClassSize(int size_class);
+
+  // Thread-exit handler registered with 'd_key'.
+  static void destroyThreadCache(void* cache);
+
+  // Return the cache of the calling thread, creating it if needed.
+  ThreadCache* threadCache();
+
+  ThreadCache* createThreadCache();
+
+  // Move 'BATCH_SIZE' blocks of the specified 'size_class' from the backing
+  // allocator into the specified empty 'magazine'.
+  void refill(Magazine* magazine, int size_class);
+
+  // Return the specified 'num_blocks' oldest blocks of the specified
+  // 'magazine' to the backing allocator.
+  void flush(Magazine* magazine, int num_blocks);
+
+  // Return every block held by the specified 'cache' to the backing
+  // allocator.  The caller must hold 'd_lock'.
+  void drainLocked(ThreadCache* cache);
+
+  // Drain, unlink and free the specified 'cache'.  The caller must hold
+  // 'd_lock'.
+  void destroyLocked(ThreadCache* cache);
+
+  void* allocateOversized(size_type size);
+
+  void deallocateOversized(void* block);
+
+ public:
+  // Create a thread-caching allocator in front of the optionally specified
+  // 'backing_allocator' (the default allocator if 0).
+  explicit ThreadCachingAllocator(Allocator* backing_allocator = 0);
+
+  // Destroy this allocator, returning every cached block of every thread to
+  // the backing allocator.
+  ~ThreadCachingAllocator() override;
+
+  // Return a block of at least the specified 'size' bytes, suitably aligned
+  // for any object of that size.  Return 0 if 'size' is 0.
+  void* allocate(size_type size) override;
+
+  // Return the block at the specified 'address' to the calling thread's
+  // cache.  If 'address' is 0 this function has no effect.
+  void deallocate(void* address) override;
+
+  // Return every block cached by the calling thread to the backing
+  // allocator.
+  void flushThreadCache();
+
+  // Return the address of the backing allocator.
+  Allocator* backingAllocator() const;
+};
+
+inline int ThreadCachingAllocator::findSizeClass(size_type size) {
+  if (size > MAX_CACHED_SIZE) {
+    return OVERSIZED;
+  }
+  if (size <= (1 << MIN_BLOCK_SHIFT)) {
+    return 0;
+  }
+
+  return AlignmentUtil::ceilLog2(size) - MIN_BLOCK_SHIFT;
+}
+
+inline ThreadCachingAllocator::size_type ThreadCachingAllocator::sizeClassSize(
+    int size_class) {
+  return static_cast<size_type>(1) << (MIN_BLOCK_SHIFT + size_class);
+}
+
+inline ThreadCachingAllocator::ThreadCache*
+ThreadCachingAllocator::threadCache() {
+  void* cache = pthread_getspecific(d_key);
+  return cache ? static_cast<ThreadCache*>(cache) : createThreadCache();
+}
+
+inline void* ThreadCachingAllocator::allocate(size_type size) {
+  if (0 == size) {
+    return 0;
+  }
+
+  const int size_class = findSizeClass(size);
+  if (OVERSIZED == size_class) {
+    return allocateOversized(size);
+  }
+
+  Magazine& magazine = threadCache()->d_magazines[size_class];
+  if (0 == magazine.d_count) {
+    refill(&magazine, size_class);
+  }
+  return static_cast<char*>(magazine.d_blocks[--magazine.d_count]) +
+         HEADER_SIZE;
+}
+
+inline void ThreadCachingAllocator::deallocate(void* address) {
+  if (!address) {
+    return;
+  }
+
+  char* block = static_cast<char*>(address) - HEADER_SIZE;
+  const int size_class = reinterpret_cast<Header*>(block)->d_size_class;
+  if (OVERSIZED == size_class) {
+    deallocateOversized(block);
+    return;
+  }
+
+  LLCL_ASSERT_SAFE(0 <= size_class && size_class < NUM_SIZE_CLASSES);
+
+  Magazine& magazine = threadCache()->d_magazines[size_class];
+  if (MAGAZINE_CAPACITY == magazine.d_count) {
+    flush(&magazine, BATCH_SIZE);
+  }
+  magazine.d_blocks[magazine.d_count++] = block;
+}
+
+inline Allocator* ThreadCachingAllocator::backingAllocator() const {
+  return d_backing_p;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MEMORYALLOCATOR_THREADCACHINGALLOCATOR_H
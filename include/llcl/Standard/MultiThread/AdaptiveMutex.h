@@ -0,0 +1,135 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_ADAPTIVEMUTEX_H
+#define LLCL_STANDARD_MULTITHREAD_ADAPTIVEMUTEX_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'AdaptiveMutex' is a futex mutex that, when it finds the lock taken, first
+// spins for a while (pausing the CPU with exponential backoff) in the hope
+// that the owner is about to release it, and only then parks in the kernel.
+// For critical sections of a few hundred nanoseconds this avoids the tens of
+// microseconds a sleep and wakeup cost.
+//
+// The number of spin iterations adapts to the recent history: each
+// contended acquisition moves the budget an eighth of the way towards the
+// number of iterations it needed, or towards zero if it had to park, and
+// the next one spins for at most twice the budget plus a small slack,
+// capped at 'maxSpins()'.  Critical sections that are usually short thus
+// keep the budget low but sufficient, while long ones quickly stop wasting
+// CPU.  The budget is shared by all threads using the mutex and only updated
+// with relaxed atomics.
+class AdaptiveMutex {
+ public:
+  enum { DEFAULT_MAX_SPINS = 100, MAX_BACKOFF = 16 };
+
+ private:
+  enum { UNLOCKED = 0, LOCKED = 1, CONTENDED = 2 };
+
+  AtomicInt d_state;
+  AtomicInt d_spin_budget;
+  AtomicInt d_max_spins;
+
+  AdaptiveMutex(const AdaptiveMutex&);
+  AdaptiveMutex& operator=(const AdaptiveMutex&);
+
+  // Spin, then park until the lock is acquired.
+  void lockContended();
+
+  // Move the spin budget towards the specified 'spins'.
+  void adapt(int spins);
+
+ public:
+  // Create an unlocked mutex that spins for at most the optionally specified
+  // 'max_spins' iterations before parking.
+  explicit AdaptiveMutex(int max_spins = DEFAULT_MAX_SPINS);
+
+  ~AdaptiveMutex();
+
+  void lock();
+
+  // Return 0 if the lock was acquired, and a non-zero value otherwise.
+  int try_lock();
+
+  void unlock();
+
+  // Set the largest number of spin iterations before parking to the
+  // specified 'max_spins'; 0 disables spinning.
+  void setMaxSpins(int max_spins);
+
+  // Return the largest number of spin iterations before parking.
+  int maxSpins() const;
+
+  // Return the current spin budget.
+  int spinBudget() const;
+
+  // Return the budget that follows the specified 'budget' after a contended
+  // acquisition that needed the specified 'spins' (0 if it parked): an
+  // eighth of the way towards 'spins', rounded away from 'budget'.
+  static int nextSpinBudget(int budget, int spins);
+};
+
+inline AdaptiveMutex::AdaptiveMutex(int max_spins)
+    : d_state(UNLOCKED), d_spin_budget(0), d_max_spins(max_spins) {
+  LLCL_ASSERT_SAFE(0 <= max_spins);
+}
+
+inline AdaptiveMutex::~AdaptiveMutex() {
+  LLCL_ASSERT_SAFE(UNLOCKED == d_state.loadRelaxed());
+}
+
+inline void AdaptiveMutex::lock() {
+  if (UNLOCKED != d_state.testAndSwapAcqRel(UNLOCKED, LOCKED)) {
+    lockContended();
+  }
+}
+
+inline int AdaptiveMutex::try_lock() {
+  return UNLOCKED == d_state.testAndSwapAcqRel(UNLOCKED, LOCKED) ? 0 : EBUSY;
+}
+
+inline void AdaptiveMutex::unlock() {
+  const int state = d_state.swapAcqRel(UNLOCKED);
+  LLCL_ASSERT_SAFE(UNLOCKED != state);
+
+  if (CONTENDED == state) {
+    FutexUtil::wake(&d_state, 1);
+  }
+}
+
+inline void AdaptiveMutex::setMaxSpins(int max_spins) {
+  LLCL_ASSERT_SAFE(0 <= max_spins);
+
+  d_max_spins.storeRelaxed(max_spins);
+}
+
+inline int AdaptiveMutex::maxSpins() const { return d_max_spins.loadRelaxed(); }
+
+inline int AdaptiveMutex::spinBudget() const {
+  return d_spin_budget.loadRelaxed();
+}
+
+inline int AdaptiveMutex::nextSpinBudget(int budget, int spins) {
+  // Truncating would leave the budget stuck up to 7 away from 'spins'.
+  const int distance = spins - budget;
+  return budget + (distance + (0 < distance ? 7 : -7)) / 8;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_ADAPTIVEMUTEX_H
@@ -0,0 +1,98 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_BARRIER_H
+#define LLCL_STANDARD_MULTITHREAD_BARRIER_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include "llcl/Standard/MultiThread/ConditionImplPthread.h"
+#include "llcl/Standard/MultiThread/MutexImplPthread.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'Barrier' blocks each of a fixed number of threads in 'wait' until all of
+// them have called it, then releases them together and starts a new phase,
+// so the same barrier can be used for any number of rounds.
+//
+// Arrivals increment an 'AtomicInt' counter, and the last one advances the
+// phase number the others wait on.  On a multiprocessor, waiters first spin
+// for 'SPIN_COUNT' iterations, since with balanced work the phase often
+// completes within a few microseconds, and only then sleep: on a futex
+// where available (the last arrival only enters the kernel if somebody
+// sleeps), and on a condition variable otherwise.  The counter and the
+// phase number are on separate cache lines, so arrivals do not disturb
+// spinning waiters.
+class Barrier {
+ public:
+  enum { SPIN_COUNT = 200 };
+
+ private:
+  // The low bit of the phase word flags sleeping waiters.
+  enum { WAITERS = 1, PHASE_INCREMENT = 2 };
+
+  alignas(Platform::CACHE_LINE_SIZE) AtomicInt d_arrived;
+  alignas(Platform::CACHE_LINE_SIZE) AtomicInt d_phase;
+  const int d_num_threads;
+#ifndef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  MutexImpl<Platform::PosixThreads> d_mutex;
+  ConditionImpl<Platform::PosixThreads> d_condition;
+#endif
+
+  Barrier(const Barrier&);
+  Barrier& operator=(const Barrier&);
+
+  // Wait until the phase is no longer the specified 'phase'.
+  void awaitPhase(int phase);
+
+  // Start the phase after the specified 'phase' and wake its waiters.
+  void completePhase(int phase);
+
+ public:
+  // Create a barrier for the specified 'num_threads' threads.
+  explicit Barrier(int num_threads);
+
+  ~Barrier();
+
+  // Return the number of threads that must call 'wait' to complete a phase.
+  int numThreads() const;
+
+  // Block until 'numThreads()' threads, including this one, have called
+  // 'wait' in the current phase.  Return 'true' in exactly one of them, the
+  // last to arrive, and 'false' in the others.
+  bool wait();
+};
+
+inline Barrier::Barrier(int num_threads)
+    : d_arrived(0), d_phase(0), d_num_threads(num_threads) {
+  LLCL_ASSERT_SAFE(0 < num_threads);
+}
+
+inline Barrier::~Barrier() {}
+
+inline int Barrier::numThreads() const { return d_num_threads; }
+
+inline bool Barrier::wait() {
+  // The phase cannot advance before this thread has arrived.
+  const int phase = d_phase.loadAcquire() & ~WAITERS;
+
+  if (d_num_threads == d_arrived.addAcqRel(1)) {
+    // Threads only arrive for the next phase once they see it started.
+    d_arrived.storeRelaxed(0);
+    completePhase(phase);
+    return true;
+  }
+  awaitPhase(phase);
+  return false;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_BARRIER_H
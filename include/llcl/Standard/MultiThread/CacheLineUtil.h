@@ -0,0 +1,57 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CACHELINEUTIL_H
+#define LLCL_STANDARD_MULTITHREAD_CACHELINEUTIL_H
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'CacheLineUtil' allocates blocks that start on a cache line boundary.
+// 'ma::Allocator' only guarantees 'MAX_ALIGNMENT', so a per-thread record
+// padded to a multiple of 'CACHE_LINE_SIZE' would still straddle two lines
+// shared with its neighbours; a block from 'allocate' over-allocates by one
+// line and keeps the address it got from the allocator in the word just
+// before the block it returns.
+struct CacheLineUtil {
+  typedef Types::size_type size_type;
+
+  // Return a block of at least the specified 'size' bytes, aligned to
+  // 'Platform::CACHE_LINE_SIZE', allocated from the specified 'allocator'.
+  static void* allocate(ma::Allocator* allocator, size_type size);
+
+  // Return the specified 'block', obtained from 'allocate' with the
+  // specified 'allocator', to 'allocator'.  Do nothing if 'block' is 0.
+  static void deallocate(ma::Allocator* allocator, void* block);
+};
+
+inline void* CacheLineUtil::allocate(ma::Allocator* allocator,
+                                     size_type size) {
+  LLCL_ASSERT_SAFE(allocator);
+
+  char* raw = static_cast<char*>(
+      allocator->allocate(size + sizeof(void*) + Platform::CACHE_LINE_SIZE));
+  char* block = raw + sizeof(void*);
+  block += ma::AlignmentUtil::calculateAlignmentOffset(
+      block, Platform::CACHE_LINE_SIZE);
+  reinterpret_cast<void**>(block)[-1] = raw;
+  return block;
+}
+
+inline void CacheLineUtil::deallocate(ma::Allocator* allocator, void* block) {
+  LLCL_ASSERT_SAFE(allocator);
+
+  if (block) {
+    allocator->deallocate(static_cast<void**>(block)[-1]);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CACHELINEUTIL_H
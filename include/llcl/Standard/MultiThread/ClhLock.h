@@ -0,0 +1,56 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CLHLOCK_H
+#define LLCL_STANDARD_MULTITHREAD_CLHLOCK_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'ClhLock' is the queue lock of Craig, Landin and Hagersten.  A waiter
+// swaps its node into the tail pointer and spins on the node of its
+// predecessor, which the predecessor clears on release.  Like 'McsLock' it
+// is FIFO with each waiter spinning on its own cache line, but release is
+// a single store with no need to wait for a successor to link in; the
+// price is that the spun-on line was last written by another thread, which
+// costs more on NUMA machines.
+//
+// On release a thread keeps its predecessor's node for its next
+// acquisition, so nodes migrate between threads: they are allocated from
+// the heap on first use and freed at thread exit, and the lock owns and
+// frees the node at the tail.  A thread can hold up to 'MAX_NESTING' of
+// these locks at a time, releasing them in the reverse order of
+// acquisition.  As the tail node may be handed to another thread at any
+// time, there is no safe way to inspect it, and thus no 'try_lock'.
+class ClhLock {
+ public:
+  enum { MAX_NESTING = 4 };
+
+  struct alignas(Platform::CACHE_LINE_SIZE) Node {
+    AtomicInt d_locked;
+  };
+
+ private:
+  alignas(Platform::CACHE_LINE_SIZE) AtomicPointer<Node> d_tail;
+  Node* d_owner_p;  // accessed by the owner only
+  Node* d_pred_p;   // accessed by the owner only
+
+  ClhLock(const ClhLock&);
+  ClhLock& operator=(const ClhLock&);
+
+ public:
+  ClhLock();
+
+  ~ClhLock();
+
+  void lock();
+
+  void unlock();
+};
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CLHLOCK_H
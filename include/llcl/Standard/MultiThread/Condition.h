@@ -0,0 +1,73 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CONDITION_H
+#define LLCL_STANDARD_MULTITHREAD_CONDITION_H
+
+#include "llcl/Standard/MultiThread/ConditionImplFutex.h"
+#include "llcl/Standard/MultiThread/ConditionImplInstrumented.h"
+#include "llcl/Standard/MultiThread/ConditionImplPthread.h"
+#include "llcl/Standard/MultiThread/Mutex.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+// 'Condition' is a condition variable for 'Mutex', using the same
+// 'Platform::ThreadPolicy'.  Deadlines are absolute 'timespec' values of the
+// clock chosen at construction, 'CLOCK_MONOTONIC' by default.  As usual,
+// waits can return spuriously and callers must recheck their predicate.
+class Condition {
+  ConditionImpl<Platform::ThreadPolicy> data_impl;
+
+  Condition(const Condition&);
+  Condition& operator=(const Condition&);
+
+ public:
+  // Create a condition whose deadlines are measured against the optionally
+  // specified 'clock' ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit Condition(clockid_t clock = CLOCK_MONOTONIC);
+
+  ~Condition();
+
+  // Wake all threads waiting on this condition.
+  void broadcast();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  // Wake at least one thread waiting on this condition, if any.
+  void signal();
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled or for
+  // 'clockType()' to reach the specified 'deadline', then lock 'mutex'
+  // again.  Return 0 if signaled (or woken spuriously), and 'ETIMEDOUT'
+  // otherwise.
+  int timedWait(Mutex* mutex, const timespec& deadline);
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled (or
+  // woken spuriously), then lock 'mutex' again.
+  void wait(Mutex* mutex);
+};
+
+inline Condition::Condition(clockid_t clock) : data_impl(clock) {}
+
+inline Condition::~Condition() {}
+
+inline void Condition::broadcast() { data_impl.broadcast(); }
+
+inline clockid_t Condition::clockType() const { return data_impl.clockType(); }
+
+inline void Condition::signal() { data_impl.signal(); }
+
+inline int Condition::timedWait(Mutex* mutex, const timespec& deadline) {
+  return data_impl.timedWait(&mutex->data_impl, deadline);
+}
+
+inline void Condition::wait(Mutex* mutex) { data_impl.wait(&mutex->data_impl); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CONDITION_H
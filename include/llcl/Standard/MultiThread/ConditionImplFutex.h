@@ -0,0 +1,99 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLFUTEX_H
+#define LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLFUTEX_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <time.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/MultiThread/MutexImplFutex.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+// A condition variable that is a futex sequence number, waited on with a
+// 'MutexImpl<Platform::FutexThreads>'.  'signal' and 'broadcast' bump the
+// sequence number, so a waiter whose sleep races with them does not block.
+//
+// Rather than waking every waiter only for all but one to block again on
+// the mutex, 'broadcast' wakes one waiter and requeues the others onto the
+// mutex word ("wait morphing"), from which each unlock wakes the next.  For
+// this, all waiters of a condition must use the same mutex, and threads
+// woken from a wait reacquire it marked as contended.
+template <>
+class ConditionImpl<Platform::FutexThreads> {
+  AtomicInt d_sequence;
+  AtomicPointer<MutexImpl<Platform::FutexThreads> > d_mutex_p;
+  clockid_t d_clock;
+
+  ConditionImpl(const ConditionImpl&);
+  ConditionImpl& operator=(const ConditionImpl&);
+
+ public:
+  // Create a condition whose deadlines are measured against the optionally
+  // specified 'clock' ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit ConditionImpl(clockid_t clock = CLOCK_MONOTONIC);
+
+  ~ConditionImpl();
+
+  void broadcast();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  void signal();
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled or for
+  // the clock to reach the specified 'deadline', then lock 'mutex' again.
+  // Return 0 if signaled (or woken spuriously), and 'ETIMEDOUT' otherwise.
+  int timedWait(MutexImpl<Platform::FutexThreads>* mutex,
+                const timespec& deadline);
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled (or
+  // woken spuriously), then lock 'mutex' again.
+  void wait(MutexImpl<Platform::FutexThreads>* mutex);
+};
+
+inline ConditionImpl<Platform::FutexThreads>::ConditionImpl(clockid_t clock)
+    : d_sequence(0), d_mutex_p(0), d_clock(clock) {
+  LLCL_ASSERT_SAFE(CLOCK_MONOTONIC == clock || CLOCK_REALTIME == clock);
+}
+
+inline ConditionImpl<Platform::FutexThreads>::~ConditionImpl() {}
+
+inline clockid_t ConditionImpl<Platform::FutexThreads>::clockType() const {
+  return d_clock;
+}
+
+inline void ConditionImpl<Platform::FutexThreads>::signal() {
+  d_sequence.addAcqRel(1);
+  FutexUtil::wake(&d_sequence, 1);
+}
+
+inline void ConditionImpl<Platform::FutexThreads>::wait(
+    MutexImpl<Platform::FutexThreads>* mutex) {
+  LLCL_ASSERT_SAFE(!d_mutex_p.loadRelaxed() ||
+                   mutex == d_mutex_p.loadRelaxed());
+
+  d_mutex_p.storeRelease(mutex);
+  const int sequence = d_sequence.loadAcquire();
+  mutex->unlock();
+  FutexUtil::wait(&d_sequence, sequence);
+  mutex->lockRequeued();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLFUTEX_H
@@ -0,0 +1,97 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLINSTRUMENTED_H
+#define LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLINSTRUMENTED_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <time.h>
+
+#include "llcl/Standard/MultiThread/ConditionImplFutex.h"
+#include "llcl/Standard/MultiThread/ConditionImplPthread.h"
+#include "llcl/Standard/MultiThread/MutexImplInstrumented.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+// A 'Platform::BaseThreadPolicy' condition waited on with a
+// 'MutexImpl<Platform::InstrumentedThreads>'.  A wait ends the current hold
+// of the mutex, and reacquiring it counts as an uncontended acquisition:
+// the time spent waiting for the signal is not lock contention.
+template <>
+class ConditionImpl<Platform::InstrumentedThreads> {
+  ConditionImpl<Platform::BaseThreadPolicy> data_cond;
+
+  ConditionImpl(const ConditionImpl&);
+  ConditionImpl& operator=(const ConditionImpl&);
+
+ public:
+  // Create a condition whose deadlines are measured against the optionally
+  // specified 'clock' ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit ConditionImpl(clockid_t clock = CLOCK_MONOTONIC);
+
+  ~ConditionImpl();
+
+  void broadcast();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  void signal();
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled or for
+  // the clock to reach the specified 'deadline', then lock 'mutex' again.
+  // Return 0 if signaled (or woken spuriously), and 'ETIMEDOUT' otherwise.
+  int timedWait(MutexImpl<Platform::InstrumentedThreads>* mutex,
+                const timespec& deadline);
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled (or
+  // woken spuriously), then lock 'mutex' again.
+  void wait(MutexImpl<Platform::InstrumentedThreads>* mutex);
+};
+
+inline ConditionImpl<Platform::InstrumentedThreads>::ConditionImpl(
+    clockid_t clock)
+    : data_cond(clock) {}
+
+inline ConditionImpl<Platform::InstrumentedThreads>::~ConditionImpl() {}
+
+inline void ConditionImpl<Platform::InstrumentedThreads>::broadcast() {
+  data_cond.broadcast();
+}
+
+inline clockid_t ConditionImpl<Platform::InstrumentedThreads>::clockType()
+    const {
+  return data_cond.clockType();
+}
+
+inline void ConditionImpl<Platform::InstrumentedThreads>::signal() {
+  data_cond.signal();
+}
+
+inline int ConditionImpl<Platform::InstrumentedThreads>::timedWait(
+    MutexImpl<Platform::InstrumentedThreads>* mutex, const timespec& deadline) {
+  mutex->recordRelease();
+  const int status = data_cond.timedWait(&mutex->data_lock, deadline);
+  mutex->recordAcquire();
+  return status;
+}
+
+inline void ConditionImpl<Platform::InstrumentedThreads>::wait(
+    MutexImpl<Platform::InstrumentedThreads>* mutex) {
+  mutex->recordRelease();
+  data_cond.wait(&mutex->data_lock);
+  mutex->recordAcquire();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLINSTRUMENTED_H
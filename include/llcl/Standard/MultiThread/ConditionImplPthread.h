@@ -0,0 +1,87 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLPTHREAD_H
+#define LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLPTHREAD_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+#include <time.h>
+
+#include "llcl/Standard/MultiThread/MutexImplPthread.h"
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+// A 'pthread_cond_t' bound to the chosen clock, waited on with the
+// 'pthread_mutex_t' of a 'MutexImpl<Platform::PosixThreads>'.
+template <>
+class ConditionImpl<Platform::PosixThreads> {
+  pthread_cond_t data_cond;
+  clockid_t d_clock;
+
+  ConditionImpl(const ConditionImpl&);
+  ConditionImpl& operator=(const ConditionImpl&);
+
+ public:
+  // Create a condition whose deadlines are measured against the optionally
+  // specified 'clock' ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit ConditionImpl(clockid_t clock = CLOCK_MONOTONIC);
+
+  ~ConditionImpl();
+
+  void broadcast();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  void signal();
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled or for
+  // the clock to reach the specified 'deadline', then lock 'mutex' again.
+  // Return 0 if signaled (or woken spuriously), and 'ETIMEDOUT' otherwise.
+  int timedWait(MutexImpl<Platform::PosixThreads>* mutex,
+                const timespec& deadline);
+
+  // Atomically unlock the specified 'mutex' and wait to be signaled (or
+  // woken spuriously), then lock 'mutex' again.
+  void wait(MutexImpl<Platform::PosixThreads>* mutex);
+};
+
+inline void ConditionImpl<Platform::PosixThreads>::broadcast() {
+  pthread_cond_broadcast(&data_cond);
+}
+
+inline clockid_t ConditionImpl<Platform::PosixThreads>::clockType() const {
+  return d_clock;
+}
+
+inline void ConditionImpl<Platform::PosixThreads>::signal() {
+  pthread_cond_signal(&data_cond);
+}
+
+inline int ConditionImpl<Platform::PosixThreads>::timedWait(
+    MutexImpl<Platform::PosixThreads>* mutex, const timespec& deadline) {
+  return pthread_cond_timedwait(&data_cond, &mutex->native_mutex(),
+                                &deadline);
+}
+
+inline void ConditionImpl<Platform::PosixThreads>::wait(
+    MutexImpl<Platform::PosixThreads>* mutex) {
+  const int status = pthread_cond_wait(&data_cond, &mutex->native_mutex());
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_CONDITIONIMPLPTHREAD_H
@@ -0,0 +1,226 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_EPOCHDOMAIN_H
+#define LLCL_STANDARD_MULTITHREAD_EPOCHDOMAIN_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'EpochDomain' provides epoch-based reclamation (EBR) for lock-free data
+// structures built on 'AtomicPointer': a node unlinked from such a structure
+// may still be read by threads that loaded a pointer to it earlier, so
+// instead of being deleted right away it is handed to 'retire', which
+// deletes it once no thread can hold a reference any more.
+//
+// Readers bracket every access to the shared structure with 'enter' and
+// 'exit' (or an 'EpochGuard').  Entering publishes the current global epoch
+// in the thread's record; exiting clears it.  Both are a single store to a
+// cache line owned by the calling thread, so readers pay almost nothing.
+// The global epoch only advances once every thread inside a critical
+// section has observed it, and an object retired in epoch 'e' is deleted
+// once the global epoch reaches 'e + 2'.  Reclamation is amortized: every
+// 'RETIRE_THRESHOLD' retirements the retiring thread tries to advance the
+// epoch and deletes whatever has become safe.
+//
+// A thread that stalls inside a critical section blocks the epoch and hence
+// all reclamation; 'HazardPointerDomain' bounds memory in that case.
+//
+// Retired objects are destroyed and deallocated with the domain's
+// allocator, which therefore must be thread-safe and must be the allocator
+// the objects were created with.  Per-thread records are kept for the
+// lifetime of the domain and reused by threads created later; objects a
+// thread leaves pending when it exits are deleted by 'reclaim' or by the
+// next owner of its record.  The behavior is undefined if the domain is
+// destroyed while a thread is inside a critical section.
+class EpochDomain {
+ public:
+  enum { RETIRE_THRESHOLD = 64 };
+
+ private:
+  typedef void (*Deleter)(void* object, ma::Allocator* allocator);
+
+  struct Retired {
+    Retired* d_next_p;
+    void* d_object_p;
+    Deleter d_deleter;
+  };
+
+  // The objects retired in one epoch.
+  struct Limbo {
+    Types::Uint64 d_epoch;
+    Retired* d_head_p;
+  };
+
+  enum { NUM_LIMBO_LISTS = 3, ACTIVE = 1 };
+
+  // The state of one thread.  'd_state' is the only field read by other
+  // threads: the epoch the thread entered in, shifted left by one, with the
+  // low bit set while the thread is inside a critical section.
+  struct Record {
+    AtomicUint64 d_state;
+    AtomicInt d_in_use;
+    AtomicPointer<Record> d_next;
+    EpochDomain* d_domain_p;
+    int d_nesting;
+    int d_num_retired;
+    Limbo d_limbo[NUM_LIMBO_LISTS];
+    Retired* d_free_nodes_p;
+  };
+
+  // Align records to a cache line, and round their size up to a multiple
+  // of it, so that readers never share one.  Records are allocated with
+  // 'CacheLineUtil', which honors the alignment.
+  struct alignas(Platform::CACHE_LINE_SIZE) PaddedRecord : Record {};
+
+  AtomicUint64 d_epoch;
+  char d_epoch_pad[Platform::CACHE_LINE_SIZE - sizeof(AtomicUint64)];
+  AtomicPointer<Record> d_records;
+  pthread_key_t d_key;
+  ma::Allocator* d_allocator_p;
+
+  EpochDomain(const EpochDomain&);
+  EpochDomain& operator=(const EpochDomain&);
+
+  template <class TYPE>
+  static void deleteObject(void* object, ma::Allocator* allocator);
+
+  // Thread-exit handler registered with 'd_key'.
+  static void releaseRecord(void* record);
+
+  // Return the record of the calling thread, acquiring one if needed.
+  Record* threadRecord();
+
+  // Claim a free record or create a new one for the calling thread.
+  Record* acquireRecord();
+
+  // Delete every object on the specified 'list' and recycle its nodes
+  // into the specified 'record'.
+  void deleteList(Record* record, Retired* list);
+
+  // Advance the global epoch if every thread inside a critical section has
+  // observed it.  Return the resulting global epoch.
+  Types::Uint64 tryAdvance();
+
+  // Delete the objects of the specified 'record' that were retired at
+  // least two epochs before the specified 'epoch'.
+  void collect(Record* record, Types::Uint64 epoch);
+
+  void retireImpl(void* object, Deleter deleter);
+
+ public:
+  // Create a domain deleting retired objects with the optionally specified
+  // 'basic_allocator' (the default allocator if 0).
+  explicit EpochDomain(ma::Allocator* basic_allocator = 0);
+
+  // Destroy this domain, deleting every object still pending.
+  ~EpochDomain();
+
+  // Enter a read-side critical section.  Pointers loaded from the shared
+  // structure remain valid until the matching 'exit'.  Critical sections
+  // may be nested.
+  void enter();
+
+  // Leave the critical section entered by the matching 'enter'.
+  void exit();
+
+  // Delete the specified 'object', which must already be unreachable from
+  // the shared structure and have been created with this domain's
+  // allocator, once no thread can still be reading it.
+  template <class TYPE>
+  void retire(TYPE* object);
+
+  // Try to advance the epoch and delete whatever the calling thread, or any
+  // thread that has since exited, retired and is now safe.  Call this
+  // outside of a critical section, e.g. when a thread goes idle, to avoid
+  // holding retired memory indefinitely.
+  void reclaim();
+
+  // Return the current global epoch.
+  Types::Uint64 epoch() const;
+
+  // Return the address of the allocator used to delete retired objects.
+  ma::Allocator* allocator() const;
+};
+
+// 'EpochGuard' keeps the calling thread inside a read-side critical section
+// of an 'EpochDomain' for its lifetime.
+class EpochGuard {
+  EpochDomain* d_domain_p;
+
+  EpochGuard(const EpochGuard&);
+  EpochGuard& operator=(const EpochGuard&);
+
+ public:
+  // Enter a critical section of the specified 'domain'.
+  explicit EpochGuard(EpochDomain* domain);
+
+  // Leave the critical section.
+  ~EpochGuard();
+};
+
+template <class TYPE>
+void EpochDomain::deleteObject(void* object, ma::Allocator* allocator) {
+  allocator->deleteObject(static_cast<TYPE*>(object));
+}
+
+inline EpochDomain::Record* EpochDomain::threadRecord() {
+  void* record = pthread_getspecific(d_key);
+  return record ? static_cast<Record*>(record) : acquireRecord();
+}
+
+inline void EpochDomain::enter() {
+  Record* record = threadRecord();
+  if (record->d_nesting++) {
+    return;
+  }
+
+  // The sequentially consistent store orders the publication before every
+  // later load of a shared pointer.
+  record->d_state.store(d_epoch.loadAcquire() << 1 | ACTIVE);
+}
+
+inline void EpochDomain::exit() {
+  Record* record = static_cast<Record*>(pthread_getspecific(d_key));
+  LLCL_ASSERT_SAFE(record && 0 < record->d_nesting);
+
+  if (--record->d_nesting) {
+    return;
+  }
+  record->d_state.storeRelease(record->d_state.loadRelaxed() & ~ACTIVE);
+}
+
+template <class TYPE>
+inline void EpochDomain::retire(TYPE* object) {
+  retireImpl(const_cast<void*>(static_cast<const volatile void*>(object)),
+             &deleteObject<TYPE>);
+}
+
+inline Types::Uint64 EpochDomain::epoch() const {
+  return d_epoch.loadAcquire();
+}
+
+inline ma::Allocator* EpochDomain::allocator() const { return d_allocator_p; }
+
+inline EpochGuard::EpochGuard(EpochDomain* domain) : d_domain_p(domain) {
+  d_domain_p->enter();
+}
+
+inline EpochGuard::~EpochGuard() { d_domain_p->exit(); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_EPOCHDOMAIN_H
@@ -0,0 +1,89 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_FUTEXUTIL_H
+#define LLCL_STANDARD_MULTITHREAD_FUTEXUTIL_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'FutexUtil' wraps the Linux 'futex' system call for the process-private
+// wait queues used by the futex-based synchronization primitives.  The
+// futex word is an 'AtomicInt', which has the size and representation of an
+// 'int'.
+struct FutexUtil {
+  // Block the calling thread while the specified 'word' holds the specified
+  // 'expected' value, until woken by 'wake'.  Return 0 when woken, or -1 if
+  // 'word' did not hold 'expected' or the wait was interrupted; spurious
+  // wakeups are possible, so callers must recheck their condition.
+  static int wait(AtomicInt* word, int expected);
+
+  // Wake up to the specified 'count' threads blocked on the specified
+  // 'word'.  Return the number of threads woken.
+  static int wake(AtomicInt* word, int count);
+
+  // Block like 'wait', but only until the specified 'clock'
+  // ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME') reaches the specified absolute
+  // 'deadline'.  Return 0 when woken, and -1 otherwise, with 'errno' set to
+  // 'ETIMEDOUT' if the deadline passed.
+  static int waitUntil(AtomicInt* word, int expected,
+                       const timespec& deadline, clockid_t clock);
+
+  // If the specified 'word' holds the specified 'expected' value, wake up
+  // to the specified 'wake_count' threads blocked on it and move up to the
+  // specified 'requeue_count' others to wait on the specified 'target'
+  // instead, and return the number of threads woken or moved.  Otherwise
+  // return -1 with 'errno' set to 'EAGAIN'.
+  static int requeue(AtomicInt* word, int expected, int wake_count,
+                     AtomicInt* target, int requeue_count);
+};
+
+static_assert(sizeof(AtomicInt) == sizeof(int),
+              "the futex word must be a plain 'int'");
+
+inline int FutexUtil::wait(AtomicInt* word, int expected) {
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<int*>(word),
+                                  FUTEX_WAIT_PRIVATE, expected, 0, 0, 0));
+}
+
+inline int FutexUtil::wake(AtomicInt* word, int count) {
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<int*>(word),
+                                  FUTEX_WAKE_PRIVATE, count, 0, 0, 0));
+}
+
+inline int FutexUtil::waitUntil(AtomicInt* word, int expected,
+                                const timespec& deadline, clockid_t clock) {
+  const int op = CLOCK_REALTIME == clock
+                     ? FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME
+                     : FUTEX_WAIT_BITSET_PRIVATE;
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<int*>(word), op,
+                                  expected, &deadline, 0,
+                                  FUTEX_BITSET_MATCH_ANY));
+}
+
+inline int FutexUtil::requeue(AtomicInt* word, int expected, int wake_count,
+                              AtomicInt* target, int requeue_count) {
+  // The requeue count travels in the timeout argument.
+  return static_cast<int>(
+      syscall(SYS_futex, reinterpret_cast<int*>(word),
+              FUTEX_CMP_REQUEUE_PRIVATE, wake_count,
+              reinterpret_cast<void*>(static_cast<long>(requeue_count)),
+              reinterpret_cast<int*>(target), expected));
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_FUTEXUTIL_H
@@ -0,0 +1,232 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_HAZARDPOINTERDOMAIN_H
+#define LLCL_STANDARD_MULTITHREAD_HAZARDPOINTERDOMAIN_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'HazardPointerDomain' provides hazard-pointer reclamation for lock-free
+// data structures built on 'AtomicPointer'.  Before dereferencing a shared
+// node a reader publishes its address in one of the 'SLOTS_PER_THREAD'
+// hazard slots of its thread, through a 'HazardPointerGuard'; a node handed
+// to 'retire' is only deleted once no slot holds its address.
+//
+// Each thread keeps its own list of retired objects.  When the list reaches
+// 'RETIRE_THRESHOLD' objects plus twice the number of hazard slots in the
+// domain, the thread snapshots all slots and deletes every object not found
+// in the snapshot, which frees at least half of the list.  Unlike with
+// 'EpochDomain', a reader that stalls can only keep the (at most
+// 'SLOTS_PER_THREAD') nodes it protects alive, so memory stays bounded no
+// matter what other threads do.  The price is a sequentially consistent
+// store and a reload for every protected pointer.
+//
+// Retired objects are destroyed and deallocated with the domain's
+// allocator, which therefore must be thread-safe and must be the allocator
+// the objects were created with.  Per-thread records are kept for the
+// lifetime of the domain and reused by threads created later; objects a
+// thread leaves pending when it exits are deleted by 'reclaim' or by the
+// next owner of its record.  The behavior is undefined if the domain is
+// destroyed while a guard is still protecting a pointer.
+class HazardPointerDomain {
+ public:
+  enum { SLOTS_PER_THREAD = 4, RETIRE_THRESHOLD = 64 };
+
+ private:
+  friend class HazardPointerGuard;
+
+  typedef void (*Deleter)(void* object, ma::Allocator* allocator);
+
+  struct Retired {
+    Retired* d_next_p;
+    void* d_object_p;
+    Deleter d_deleter;
+  };
+
+  // The state of one thread.  'd_slots' are the only fields read by other
+  // threads.
+  struct Record {
+    AtomicPointer<char> d_slots[SLOTS_PER_THREAD];
+    AtomicInt d_in_use;
+    AtomicPointer<Record> d_next;
+    HazardPointerDomain* d_domain_p;
+    int d_num_guards;
+    int d_num_retired;
+    Retired* d_retired_p;
+    Retired* d_free_nodes_p;
+  };
+
+  // A record allocated by 'CacheLineUtil': the hazard slots of different
+  // threads never share a cache line.
+  struct alignas(Platform::CACHE_LINE_SIZE) PaddedRecord : Record {};
+
+  AtomicPointer<Record> d_records;
+  AtomicInt d_num_records;
+  pthread_key_t d_key;
+  ma::Allocator* d_allocator_p;
+
+  HazardPointerDomain(const HazardPointerDomain&);
+  HazardPointerDomain& operator=(const HazardPointerDomain&);
+
+  template <class TYPE>
+  static void deleteObject(void* object, ma::Allocator* allocator);
+
+  // Thread-exit handler registered with 'd_key'.
+  static void releaseRecord(void* record);
+
+  // Return the record of the calling thread, acquiring one if needed.
+  Record* threadRecord();
+
+  // Claim a free record or create a new one for the calling thread.
+  Record* acquireRecord();
+
+  // Delete every retired object of the specified 'record' whose address is
+  // not in any hazard slot.
+  void scan(Record* record);
+
+  void retireImpl(void* object, Deleter deleter);
+
+ public:
+  // Create a domain deleting retired objects with the optionally specified
+  // 'basic_allocator' (the default allocator if 0).
+  explicit HazardPointerDomain(ma::Allocator* basic_allocator = 0);
+
+  // Destroy this domain, deleting every object still pending.
+  ~HazardPointerDomain();
+
+  // Delete the specified 'object', which must already be unreachable from
+  // the shared structure and have been created with this domain's
+  // allocator, once no hazard slot holds its address.
+  template <class TYPE>
+  void retire(TYPE* object);
+
+  // Delete whatever the calling thread, or any thread that has since
+  // exited, retired and is no longer protected.
+  void reclaim();
+
+  // Return the number of objects retired by the calling thread and not yet
+  // deleted.
+  int numRetired();
+
+  // Return the address of the allocator used to delete retired objects.
+  ma::Allocator* allocator() const;
+};
+
+// 'HazardPointerGuard' owns one hazard slot of the calling thread for its
+// lifetime.  Guards must be destroyed in the reverse order of their
+// creation, and a thread can hold at most
+// 'HazardPointerDomain::SLOTS_PER_THREAD' of them at a time.
+class HazardPointerGuard {
+  AtomicPointer<char>* d_slot_p;
+  HazardPointerDomain::Record* d_record_p;
+
+  HazardPointerGuard(const HazardPointerGuard&);
+  HazardPointerGuard& operator=(const HazardPointerGuard&);
+
+ public:
+  // Take the next free hazard slot of the calling thread in the specified
+  // 'domain'.
+  explicit HazardPointerGuard(HazardPointerDomain* domain);
+
+  // Clear and give back the slot.
+  ~HazardPointerGuard();
+
+  // Load the pointer held by the specified 'source' and protect it: the
+  // returned node is not deleted until this guard protects something else
+  // or is destroyed.
+  template <class TYPE>
+  TYPE* protect(const AtomicPointer<TYPE>& source);
+
+  // Protect the specified 'pointer', which the caller has already
+  // validated as reachable.
+  template <class TYPE>
+  void set(TYPE* pointer);
+
+  // Stop protecting the current pointer.
+  void reset();
+};
+
+template <class TYPE>
+void HazardPointerDomain::deleteObject(void* object,
+                                       ma::Allocator* allocator) {
+  allocator->deleteObject(static_cast<TYPE*>(object));
+}
+
+inline HazardPointerDomain::Record* HazardPointerDomain::threadRecord() {
+  void* record = pthread_getspecific(d_key);
+  return record ? static_cast<Record*>(record) : acquireRecord();
+}
+
+template <class TYPE>
+inline void HazardPointerDomain::retire(TYPE* object) {
+  retireImpl(const_cast<void*>(static_cast<const volatile void*>(object)),
+             &deleteObject<TYPE>);
+}
+
+inline int HazardPointerDomain::numRetired() {
+  return threadRecord()->d_num_retired;
+}
+
+inline ma::Allocator* HazardPointerDomain::allocator() const {
+  return d_allocator_p;
+}
+
+inline HazardPointerGuard::HazardPointerGuard(HazardPointerDomain* domain)
+    : d_record_p(domain->threadRecord()) {
+  LLCL_ASSERT(d_record_p->d_num_guards <
+              HazardPointerDomain::SLOTS_PER_THREAD);
+
+  d_slot_p = &d_record_p->d_slots[d_record_p->d_num_guards++];
+}
+
+inline HazardPointerGuard::~HazardPointerGuard() {
+  LLCL_ASSERT_SAFE(d_slot_p ==
+                   &d_record_p->d_slots[d_record_p->d_num_guards - 1]);
+
+  d_slot_p->storeRelease(0);
+  --d_record_p->d_num_guards;
+}
+
+template <class TYPE>
+inline TYPE* HazardPointerGuard::protect(const AtomicPointer<TYPE>& source) {
+  TYPE* pointer = source.loadAcquire();
+  for (;;) {
+    // The sequentially consistent store orders the publication before the
+    // validating reload; a scan that misses it cannot have missed the
+    // unlinking either.
+    d_slot_p->store(reinterpret_cast<char*>(
+        const_cast<void*>(static_cast<const volatile void*>(pointer))));
+
+    TYPE* current = source.loadAcquire();
+    if (current == pointer) {
+      return pointer;
+    }
+    pointer = current;
+  }
+}
+
+template <class TYPE>
+inline void HazardPointerGuard::set(TYPE* pointer) {
+  d_slot_p->store(reinterpret_cast<char*>(
+      const_cast<void*>(static_cast<const volatile void*>(pointer))));
+}
+
+inline void HazardPointerGuard::reset() { d_slot_p->storeRelease(0); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_HAZARDPOINTERDOMAIN_H
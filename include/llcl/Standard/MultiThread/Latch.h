@@ -0,0 +1,110 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_LATCH_H
+#define LLCL_STANDARD_MULTITHREAD_LATCH_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include "llcl/Standard/MultiThread/ConditionImplPthread.h"
+#include "llcl/Standard/MultiThread/MutexImplPthread.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'Latch' is a single-use countdown: threads calling 'wait' block until the
+// count, set at construction, has been brought to zero by 'countDown'.
+// On a multiprocessor, waiters spin for 'SPIN_COUNT' iterations before
+// sleeping on the count itself as a futex where available, and on a
+// condition variable otherwise; the thread reaching zero wakes them all.
+//
+// Where futexes are not available, the latch must outlive the 'countDown'
+// call that reaches zero, which may still be waking waiters when they
+// return.
+class Latch {
+ public:
+  enum { SPIN_COUNT = 200 };
+
+ private:
+  AtomicInt d_count;
+#ifndef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  MutexImpl<Platform::PosixThreads> d_mutex;
+  ConditionImpl<Platform::PosixThreads> d_condition;
+#endif
+
+  Latch(const Latch&);
+  Latch& operator=(const Latch&);
+
+  // Wake every waiter after the count reached zero.
+  void release();
+
+  // Spin, then block until the count is zero.
+  void waitContended();
+
+ public:
+  // Create a latch with the specified initial 'count'.
+  explicit Latch(int count);
+
+  ~Latch();
+
+  // Decrement the count by one.
+  void arrive();
+
+  // Decrement the count by one, then wait for it to reach zero.
+  void arriveAndWait();
+
+  // Decrement the count by the specified 'number', which must not exceed
+  // the current count.
+  void countDown(int number);
+
+  // Return the current count.
+  int currentCount() const;
+
+  // Return 'true' if the count has reached zero, and 'false' otherwise.
+  bool tryWait() const;
+
+  // Block until the count reaches zero.
+  void wait();
+};
+
+inline Latch::Latch(int count) : d_count(count) {
+  LLCL_ASSERT_SAFE(0 <= count);
+}
+
+inline Latch::~Latch() {}
+
+inline void Latch::arrive() { countDown(1); }
+
+inline void Latch::arriveAndWait() {
+  countDown(1);
+  wait();
+}
+
+inline void Latch::countDown(int number) {
+  const int count = d_count.subtractAcqRel(number);
+  LLCL_ASSERT_SAFE(0 <= count);
+
+  if (0 == count && 0 < number) {
+    release();
+  }
+}
+
+inline int Latch::currentCount() const { return d_count.loadAcquire(); }
+
+inline bool Latch::tryWait() const { return 0 == d_count.loadAcquire(); }
+
+inline void Latch::wait() {
+  if (!tryWait()) {
+    waitContended();
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_LATCH_H
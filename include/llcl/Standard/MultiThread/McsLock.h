@@ -0,0 +1,61 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MCSLOCK_H
+#define LLCL_STANDARD_MULTITHREAD_MCSLOCK_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'McsLock' is the queue lock of Mellor-Crummey and Scott.  Each waiter
+// appends a node of its own to a queue with a single swap of the tail
+// pointer and spins on a flag in that node, which its predecessor clears
+// when handing the lock over.  Waiters are thus served in FIFO order and
+// each spins on its own cache line, so a handoff costs a constant amount
+// of coherence traffic however many threads wait.
+//
+// Queue nodes come from a small per-thread stack, so a thread can hold up
+// to 'MAX_NESTING' of these locks at a time, and must release them in the
+// reverse order of acquisition.  Waiters yield the CPU after spinning for a
+// while.
+class McsLock {
+ public:
+  enum { MAX_NESTING = 4 };
+
+  struct alignas(Platform::CACHE_LINE_SIZE) Node {
+    AtomicPointer<Node> d_next;
+    AtomicInt d_locked;
+  };
+
+ private:
+  alignas(Platform::CACHE_LINE_SIZE) AtomicPointer<Node> d_tail;
+  Node* d_owner_p;  // accessed by the owner only
+
+  McsLock(const McsLock&);
+  McsLock& operator=(const McsLock&);
+
+  // Return the next free node of the calling thread.
+  static Node* pushNode();
+
+  // Give back the last node taken by the calling thread.
+  static void popNode();
+
+ public:
+  McsLock();
+
+  ~McsLock();
+
+  void lock();
+
+  // Return 0 if the lock was acquired, and a non-zero value otherwise.
+  int try_lock();
+
+  void unlock();
+};
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MCSLOCK_H
@@ -0,0 +1,295 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MPMCQUEUE_H
+#define LLCL_STANDARD_MULTITHREAD_MPMCQUEUE_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/Semaphore.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'MpmcQueue' is a bounded multi-producer, multi-consumer FIFO queue of
+// 'TYPE' values, after Vyukov's "Bounded MPMC queue".  The capacity is a
+// power of two, and every slot carries a sequence number telling which lap
+// of the ring it is ready for: a producer at position 'p' waits for
+// sequence 'p' and stores 'p + 1' once the value is written, and a consumer
+// waits for 'p + 1' and stores 'p + capacity' once it has copied the value
+// out.  Claiming a position is one compare-and-swap on the producer or the
+// consumer cursor, which are on separate cache lines, so producers and
+// consumers only meet on the slots themselves.
+//
+// 'tryPush' and 'tryPop' never block.  'push' and 'pop' park on a
+// 'Semaphore' while the queue is full or empty; a thread only pays for
+// waking them when some are parked.
+template <class TYPE>
+class MpmcQueue {
+  struct Slot {
+    AtomicUint64 d_sequence;
+    alignas(TYPE) char d_buffer[sizeof(TYPE)];
+  };
+
+  enum { CACHE_LINE_SIZE = Platform::CACHE_LINE_SIZE };
+
+  AtomicUint64 d_push_cursor;
+  char d_push_pad[CACHE_LINE_SIZE - sizeof(AtomicUint64)];
+  AtomicUint64 d_pop_cursor;
+  char d_pop_pad[CACHE_LINE_SIZE - sizeof(AtomicUint64)];
+  AtomicInt d_num_push_waiters;  // parked producers not yet woken
+  AtomicInt d_num_pop_waiters;   // parked consumers not yet woken
+  Semaphore d_not_full;
+  Semaphore d_not_empty;
+  Slot* d_slots_p;
+  Types::Uint64 d_mask;
+  ma::Allocator* d_allocator_p;
+
+  MpmcQueue(const MpmcQueue&);
+  MpmcQueue& operator=(const MpmcQueue&);
+
+  // Announce the calling thread on the specified 'waiters' and park it on
+  // the specified 'semaphore' if the specified 'attempt' (a member that
+  // returns 0 on success) still fails with the specified 'argument'.
+  template <class ARG>
+  void block(AtomicInt* waiters, Semaphore* semaphore,
+             int (MpmcQueue::*attempt)(ARG), ARG argument);
+
+  int popImpl(TYPE* value);
+
+  int pushImpl(const TYPE* value);
+
+  // Wake one thread parked on the specified 'semaphore', if the specified
+  // 'waiters' counts any.
+  static void wakeOne(AtomicInt* waiters, Semaphore* semaphore);
+
+ public:
+  // Create a queue holding up to the specified positive 'capacity' values,
+  // rounded up to a power of two, using the optionally specified
+  // 'basic_allocator' (the default allocator if 0) for the slots.
+  explicit MpmcQueue(int capacity, ma::Allocator* basic_allocator = 0);
+
+  // Destroy this queue and the values still in it.
+  ~MpmcQueue();
+
+  // Return the number of values the queue can hold.
+  int capacity() const;
+
+  // Return the number of values in the queue, which is only a hint while
+  // other threads use it.
+  int numElements() const;
+
+  // Copy-assign the oldest value to the specified 'value' and remove it
+  // from the queue, blocking while the queue is empty.
+  void pop(TYPE* value);
+
+  // Append a copy of the specified 'value', blocking while the queue is
+  // full.
+  void push(const TYPE& value);
+
+  // Copy-assign the oldest value to the specified 'value', remove it from
+  // the queue and return 0, or return a non-zero value if the queue is
+  // empty.
+  int tryPop(TYPE* value);
+
+  // Append a copy of the specified 'value' and return 0, or return a
+  // non-zero value if the queue is full.
+  int tryPush(const TYPE& value);
+};
+
+template <class TYPE>
+template <class ARG>
+void MpmcQueue<TYPE>::block(AtomicInt* waiters, Semaphore* semaphore,
+                            int (MpmcQueue::*attempt)(ARG), ARG argument) {
+  while (true) {
+    // Announce before retrying: a thread that frees a slot (or fills one)
+    // concurrently either lets this attempt succeed, or sees the waiter.
+    waiters->add(1);
+    if (0 != (this->*attempt)(argument)) {
+      semaphore->wait();
+      if (0 == (this->*attempt)(argument)) {
+        return;
+      }
+      continue;
+    }
+
+    // Withdraw the announcement, unless a waker already claimed it, in
+    // which case its post must be consumed.
+    int count = waiters->loadRelaxed();
+    while (0 < count) {
+      const int prev = waiters->testAndSwap(count, count - 1);
+      if (prev == count) {
+        return;
+      }
+      count = prev;
+    }
+    semaphore->wait();
+    return;
+  }
+}
+
+template <class TYPE>
+int MpmcQueue<TYPE>::popImpl(TYPE* value) {
+  Types::Uint64 position = d_pop_cursor.loadRelaxed();
+  Slot* slot;
+  while (true) {
+    slot = d_slots_p + (position & d_mask);
+    const Types::Int64 diff = static_cast<Types::Int64>(
+        slot->d_sequence.load() - (position + 1));
+    if (0 == diff) {
+      const Types::Uint64 prev =
+          d_pop_cursor.testAndSwapAcqRel(position, position + 1);
+      if (prev == position) {
+        break;
+      }
+      position = prev;
+    } else if (diff < 0) {
+      return 1;  // empty
+    } else {
+      position = d_pop_cursor.loadRelaxed();
+    }
+  }
+
+  TYPE* object = reinterpret_cast<TYPE*>(slot->d_buffer);
+  *value = *object;
+  object->~TYPE();
+
+  // The sequence numbers are stored and loaded sequentially consistently:
+  // a thread parking in 'block' announces itself and then loads them,
+  // while the thread that freed or filled the slot stores them and then
+  // loads the waiter count in 'wakeOne', and one of them must see the
+  // other.
+  slot->d_sequence.store(position + d_mask + 1);
+  return 0;
+}
+
+template <class TYPE>
+int MpmcQueue<TYPE>::pushImpl(const TYPE* value) {
+  Types::Uint64 position = d_push_cursor.loadRelaxed();
+  Slot* slot;
+  while (true) {
+    slot = d_slots_p + (position & d_mask);
+    const Types::Int64 diff =
+        static_cast<Types::Int64>(slot->d_sequence.load() - position);
+    if (0 == diff) {
+      const Types::Uint64 prev =
+          d_push_cursor.testAndSwapAcqRel(position, position + 1);
+      if (prev == position) {
+        break;
+      }
+      position = prev;
+    } else if (diff < 0) {
+      return 1;  // full
+    } else {
+      position = d_push_cursor.loadRelaxed();
+    }
+  }
+
+  new (slot->d_buffer) TYPE(*value);
+  slot->d_sequence.store(position + 1);  // see 'popImpl'
+  return 0;
+}
+
+template <class TYPE>
+void MpmcQueue<TYPE>::wakeOne(AtomicInt* waiters, Semaphore* semaphore) {
+  int count = waiters->load();
+  while (0 < count) {
+    const int prev = waiters->testAndSwap(count, count - 1);
+    if (prev == count) {
+      semaphore->post();
+      return;
+    }
+    count = prev;
+  }
+}
+
+template <class TYPE>
+MpmcQueue<TYPE>::MpmcQueue(int capacity, ma::Allocator* basic_allocator)
+    : d_push_cursor(0),
+      d_pop_cursor(0),
+      d_num_push_waiters(0),
+      d_num_pop_waiters(0),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < capacity);
+
+  Types::Uint64 size = 2;
+  while (size < static_cast<Types::Uint64>(capacity)) {
+    size <<= 1;
+  }
+  d_mask = size - 1;
+  d_slots_p =
+      static_cast<Slot*>(d_allocator_p->allocate(size * sizeof(Slot)));
+  for (Types::Uint64 i = 0; i < size; ++i) {
+    new (&d_slots_p[i].d_sequence) AtomicUint64(i);
+  }
+}
+
+template <class TYPE>
+MpmcQueue<TYPE>::~MpmcQueue() {
+  const Types::Uint64 end = d_push_cursor.loadRelaxed();
+  for (Types::Uint64 i = d_pop_cursor.loadRelaxed(); i != end; ++i) {
+    reinterpret_cast<TYPE*>(d_slots_p[i & d_mask].d_buffer)->~TYPE();
+  }
+  d_allocator_p->deallocate(d_slots_p);
+}
+
+template <class TYPE>
+inline int MpmcQueue<TYPE>::capacity() const {
+  return static_cast<int>(d_mask + 1);
+}
+
+template <class TYPE>
+inline int MpmcQueue<TYPE>::numElements() const {
+  const Types::Uint64 pop = d_pop_cursor.loadRelaxed();
+  const Types::Uint64 push = d_push_cursor.loadRelaxed();
+  return push > pop ? static_cast<int>(push - pop) : 0;
+}
+
+template <class TYPE>
+void MpmcQueue<TYPE>::pop(TYPE* value) {
+  if (0 != popImpl(value)) {
+    block(&d_num_pop_waiters, &d_not_empty, &MpmcQueue::popImpl, value);
+  }
+  wakeOne(&d_num_push_waiters, &d_not_full);
+}
+
+template <class TYPE>
+void MpmcQueue<TYPE>::push(const TYPE& value) {
+  if (0 != pushImpl(&value)) {
+    block(&d_num_push_waiters, &d_not_full, &MpmcQueue::pushImpl, &value);
+  }
+  wakeOne(&d_num_pop_waiters, &d_not_empty);
+}
+
+template <class TYPE>
+int MpmcQueue<TYPE>::tryPop(TYPE* value) {
+  if (0 != popImpl(value)) {
+    return 1;
+  }
+  wakeOne(&d_num_push_waiters, &d_not_full);
+  return 0;
+}
+
+template <class TYPE>
+int MpmcQueue<TYPE>::tryPush(const TYPE& value) {
+  if (0 != pushImpl(&value)) {
+    return 1;
+  }
+  wakeOne(&d_num_pop_waiters, &d_not_empty);
+  return 0;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MPMCQUEUE_H
@@ -0,0 +1,110 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MPSCQUEUE_H
+#define LLCL_STANDARD_MULTITHREAD_MPSCQUEUE_H
+
+#include "llcl/Standard/ADT/ilist_node_base.h"
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'MpscQueue' is an intrusive multi-producer, single-consumer FIFO queue of
+// 'NODE' objects, after Vyukov's "Intrusive MPSC node-based queue".  'NODE'
+// is an 'ilist_node_base<...>' instantiation, and queued objects derive
+// from it: the queue links them through the 'Next' pointer that an
+// intrusive list uses, so an object can move from a list to the queue and
+// back without allocating.  'Prev' and the parent are left alone.
+//
+// 'push' is wait-free: one atomic swap of the tail, then a store linking
+// the previous tail to the new node.  'pop' is for the single consumer.
+// While a producer is between those two steps the nodes behind it are not
+// reachable yet, so 'pop' can return 0 even though 'isEmpty' is 'false';
+// the consumer then retries later.  The queue does not own its nodes.
+template <class NODE = ilist_node_base<false, void> >
+class MpscQueue {
+  AtomicPointer<NODE> d_tail;  // producers
+  char d_tail_pad[Platform::CACHE_LINE_SIZE - sizeof(AtomicPointer<NODE>)];
+  NODE* d_head_p;  // consumer
+  NODE d_stub;     // queued whenever the queue would otherwise drain
+
+  MpscQueue(const MpscQueue&);
+  MpscQueue& operator=(const MpscQueue&);
+
+ public:
+  MpscQueue();
+
+  ~MpscQueue();
+
+  // Return 'true' if no node is queued.  Only the consumer may call this,
+  // and the answer is only a hint while producers are pushing.
+  bool isEmpty() const;
+
+  // Remove and return the oldest node, or return 0 if none is available.
+  // Only the consumer may call this.
+  NODE* pop();
+
+  // Append the specified 'node', which must not be in any other queue.
+  void push(NODE* node);
+};
+
+template <class NODE>
+inline MpscQueue<NODE>::MpscQueue() : d_tail(&d_stub), d_head_p(&d_stub) {}
+
+template <class NODE>
+inline MpscQueue<NODE>::~MpscQueue() {}
+
+template <class NODE>
+inline bool MpscQueue<NODE>::isEmpty() const {
+  return d_head_p == &d_stub && 0 == d_stub.getNextAcquire();
+}
+
+template <class NODE>
+NODE* MpscQueue<NODE>::pop() {
+  NODE* head = d_head_p;
+  NODE* next = head->getNextAcquire();
+  if (head == &d_stub) {
+    if (!next) {
+      return 0;
+    }
+    d_head_p = next;
+    head = next;
+    next = next->getNextAcquire();
+  }
+  if (next) {
+    d_head_p = next;
+    return head;
+  }
+
+  // 'head' looks like the last node.  If a producer has already swapped in
+  // a successor, it has not linked it yet: try again later.
+  if (head != d_tail.loadAcquire()) {
+    return 0;
+  }
+
+  // Requeue the stub behind 'head' so that 'head' can be removed without
+  // leaving the queue without a node.
+  push(&d_stub);
+  next = head->getNextAcquire();
+  if (next) {
+    d_head_p = next;
+    return head;
+  }
+  return 0;
+}
+
+template <class NODE>
+inline void MpscQueue<NODE>::push(NODE* node) {
+  LLCL_ASSERT_SAFE(node);
+
+  node->setNext(0);
+  NODE* prev = d_tail.swapAcqRel(node);
+  prev->setNextRelease(node);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MPSCQUEUE_H
@@ -1,6 +1,8 @@
 #ifndef LLCL_STANDARD_MULTITHREAD_MUTEX_H
 #define LLCL_STANDARD_MULTITHREAD_MUTEX_H
 
+#include "llcl/Standard/MultiThread/MutexImplFutex.h"
+#include "llcl/Standard/MultiThread/MutexImplInstrumented.h"
 #include "llcl/Standard/MultiThread/MutexImplPthread.h"
 
 namespace llcl {
@@ -13,6 +15,8 @@ class MutexImpl;
 class Mutex {
   MutexImpl<Platform::ThreadPolicy> data_impl;
 
+  friend class Condition;
+
   Mutex(const Mutex&);
   Mutex& operator=(const Mutex&);
 
@@ -21,6 +25,11 @@ class Mutex {
 
   Mutex();
 
+  // Create a mutex that, when 'Mutex' is instrumented (see 'MutexRegistry'),
+  // is registered under the specified 'name', which must outlive the mutex.
+  // Otherwise 'name' is ignored.
+  explicit Mutex(const char* name);
+
   ~Mutex();
 
   void lock();
@@ -34,6 +43,12 @@ class Mutex {
 
 inline Mutex::Mutex() {}
 
+#ifdef LLCL_STANDARD_MT_USE_INSTRUMENTED_THREADS
+inline Mutex::Mutex(const char* name) : data_impl(name) {}
+#else
+inline Mutex::Mutex(const char*) {}
+#endif
+
 inline Mutex::~Mutex() {}
 
 inline void Mutex::lock() { data_impl.lock(); }
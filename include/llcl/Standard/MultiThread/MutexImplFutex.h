@@ -0,0 +1,115 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MUTEXIMPLFUTEX_H
+#define LLCL_STANDARD_MULTITHREAD_MUTEXIMPLFUTEX_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+template <class ThreadPolicy>
+class MutexImpl;
+
+// A mutex that is a single 4-byte futex word (a 'pthread_mutex_t' is 40
+// bytes on x86-64), after "Futexes Are Tricky" (Drepper).  The word is
+// 'UNLOCKED', 'LOCKED', or 'CONTENDED' (locked, and there may be waiters).
+// Uncontended, 'lock' is one compare-and-swap and 'unlock' one swap; the
+// kernel is only entered to sleep, or to wake a sleeper.
+template <>
+class MutexImpl<Platform::FutexThreads> {
+  enum { UNLOCKED = 0, LOCKED = 1, CONTENDED = 2 };
+
+  AtomicInt data_lock;
+
+  MutexImpl(const MutexImpl&);
+  MutexImpl& operator=(const MutexImpl&);
+
+  void lockContended(int state);
+
+  // Acquire the lock after waking from a condition wait.  Other waiters may
+  // have been requeued onto this word, so it is marked contended even if
+  // the lock is free.
+  void lockRequeued();
+
+  friend class ConditionImpl<Platform::FutexThreads>;
+
+ public:
+  using NativeType = AtomicInt;
+
+  MutexImpl();
+
+  ~MutexImpl();
+
+  void lock();
+
+  NativeType& native_mutex();
+
+  int try_lock();
+
+  void unlock();
+};
+
+inline MutexImpl<Platform::FutexThreads>::MutexImpl() : data_lock(UNLOCKED) {}
+
+inline MutexImpl<Platform::FutexThreads>::~MutexImpl() {
+  LLCL_ASSERT_SAFE(UNLOCKED == data_lock.loadRelaxed());
+}
+
+inline void MutexImpl<Platform::FutexThreads>::lockContended(int state) {
+  // Announce a waiter, then sleep until the swap finds the word unlocked.
+  if (CONTENDED != state) {
+    state = data_lock.swapAcqRel(CONTENDED);
+  }
+  while (UNLOCKED != state) {
+    FutexUtil::wait(&data_lock, CONTENDED);
+    state = data_lock.swapAcqRel(CONTENDED);
+  }
+}
+
+inline void MutexImpl<Platform::FutexThreads>::lockRequeued() {
+  lockContended(LOCKED);
+}
+
+inline void MutexImpl<Platform::FutexThreads>::lock() {
+  const int state = data_lock.testAndSwapAcqRel(UNLOCKED, LOCKED);
+  if (UNLOCKED != state) {
+    lockContended(state);
+  }
+}
+
+inline MutexImpl<Platform::FutexThreads>::NativeType&
+MutexImpl<Platform::FutexThreads>::native_mutex() {
+  return data_lock;
+}
+
+inline int MutexImpl<Platform::FutexThreads>::try_lock() {
+  return UNLOCKED == data_lock.testAndSwapAcqRel(UNLOCKED, LOCKED) ? 0 : EBUSY;
+}
+
+inline void MutexImpl<Platform::FutexThreads>::unlock() {
+  const int state = data_lock.swapAcqRel(UNLOCKED);
+  LLCL_ASSERT_SAFE(UNLOCKED != state);
+
+  if (CONTENDED == state) {
+    FutexUtil::wake(&data_lock, 1);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MUTEXIMPLFUTEX_H
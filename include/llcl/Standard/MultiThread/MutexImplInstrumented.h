@@ -0,0 +1,134 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MUTEXIMPLINSTRUMENTED_H
+#define LLCL_STANDARD_MULTITHREAD_MUTEXIMPLINSTRUMENTED_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <time.h>
+
+#include "llcl/Standard/MultiThread/MutexImplFutex.h"
+#include "llcl/Standard/MultiThread/MutexImplPthread.h"
+#include "llcl/Standard/MultiThread/MutexRegistry.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ConditionImpl;
+
+template <class ThreadPolicy>
+class MutexImpl;
+
+// A 'Platform::BaseThreadPolicy' mutex that records its acquisitions, waits
+// and hold times in a 'MutexRegistry::Entry'.  'lock' first tries to take
+// the mutex and only reads the clock when that fails, so an uncontended
+// acquisition costs a 'try_lock' and a counter update, plus two clock reads
+// one time in 'HOLD_SAMPLE_PERIOD' to sample the hold time.
+template <>
+class MutexImpl<Platform::InstrumentedThreads> {
+ public:
+  enum { HOLD_SAMPLE_PERIOD = 64 };
+
+ private:
+  MutexImpl<Platform::BaseThreadPolicy> data_lock;
+  Types::Uint64 d_hold_start;  // 0 unless the current hold is timed
+  MutexRegistry::Entry d_entry;
+
+  MutexImpl(const MutexImpl&);
+  MutexImpl& operator=(const MutexImpl&);
+
+  // Return the current 'CLOCK_MONOTONIC' time in nanoseconds.
+  static Types::Uint64 now();
+
+  // Record an acquisition that did not wait.
+  void recordAcquire();
+
+  // Record the end of the current hold, if it is timed.
+  void recordRelease();
+
+  friend class ConditionImpl<Platform::InstrumentedThreads>;
+
+ public:
+  using NativeType = MutexImpl<Platform::BaseThreadPolicy>::NativeType;
+
+  // Create a mutex registered under the optionally specified 'name', which
+  // must outlive the mutex.
+  explicit MutexImpl(const char* name = 0);
+
+  ~MutexImpl();
+
+  void lock();
+
+  NativeType& native_mutex();
+
+  int try_lock();
+
+  void unlock();
+};
+
+inline MutexImpl<Platform::InstrumentedThreads>::MutexImpl(const char* name)
+    : d_hold_start(0), d_entry(name, this) {}
+
+inline MutexImpl<Platform::InstrumentedThreads>::~MutexImpl() {}
+
+inline Types::Uint64 MutexImpl<Platform::InstrumentedThreads>::now() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return static_cast<Types::Uint64>(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+inline void MutexImpl<Platform::InstrumentedThreads>::recordAcquire() {
+  if (0 == d_entry.recordAcquisition() % HOLD_SAMPLE_PERIOD) {
+    d_hold_start = now();
+  }
+}
+
+inline void MutexImpl<Platform::InstrumentedThreads>::recordRelease() {
+  if (d_hold_start) {
+    d_entry.recordHold(now() - d_hold_start);
+    d_hold_start = 0;
+  }
+}
+
+inline void MutexImpl<Platform::InstrumentedThreads>::lock() {
+  if (0 == data_lock.try_lock()) {
+    recordAcquire();
+    return;
+  }
+
+  const Types::Uint64 start = now();
+  data_lock.lock();
+  const Types::Uint64 end = now();
+  d_entry.recordAcquisition();
+  d_entry.recordWait(end - start);
+  d_hold_start = end;
+}
+
+inline MutexImpl<Platform::InstrumentedThreads>::NativeType&
+MutexImpl<Platform::InstrumentedThreads>::native_mutex() {
+  return data_lock.native_mutex();
+}
+
+inline int MutexImpl<Platform::InstrumentedThreads>::try_lock() {
+  const int status = data_lock.try_lock();
+  if (0 == status) {
+    recordAcquire();
+  }
+  return status;
+}
+
+inline void MutexImpl<Platform::InstrumentedThreads>::unlock() {
+  recordRelease();
+  data_lock.unlock();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MUTEXIMPLINSTRUMENTED_H
@@ -0,0 +1,141 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_MUTEXREGISTRY_H
+#define LLCL_STANDARD_MULTITHREAD_MUTEXREGISTRY_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <stdio.h>
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'MutexStats' is a snapshot of the statistics of one instrumented mutex.
+// Hold times are sampled: every contended acquisition is timed, and one in
+// 'MutexImpl<Platform::InstrumentedThreads>::HOLD_SAMPLE_PERIOD' of the
+// others.
+struct MutexStats {
+  enum { NUM_HOLD_BUCKETS = 32 };
+
+  // The name the mutex was created with, or 0.
+  const char* d_name;
+
+  // The address of the mutex.
+  const void* d_mutex_p;
+
+  // The number of 'lock' and successful 'try_lock' calls.
+  Types::Uint64 d_acquisitions;
+
+  // The number of 'lock' calls that found the mutex held.
+  Types::Uint64 d_contended;
+
+  // The total and the longest time spent waiting in 'lock', in nanoseconds.
+  Types::Uint64 d_total_wait_ns;
+  Types::Uint64 d_max_wait_ns;
+
+  // 'd_hold_ns[i]' counts the sampled hold times in '[2^i, 2^(i+1))'
+  // nanoseconds; the first bucket also counts 0 and the last everything
+  // longer.
+  Types::Uint64 d_hold_ns[NUM_HOLD_BUCKETS];
+
+  // Return an upper bound, in nanoseconds, of the specified 'percentile'
+  // (in '[0, 100]') of the sampled hold times, or 0 if there are none.
+  Types::Uint64 holdPercentile(double percentile) const;
+};
+
+// 'MutexRegistry' lists every live instrumented mutex so that their
+// statistics can be inspected at run time, to find the locks behind latency
+// spikes.  Build with 'LLCL_STANDARD_MT_USE_INSTRUMENTED_THREADS' to
+// instrument every 'Mutex', and create the interesting ones with a name.
+class MutexRegistry {
+ public:
+  // The live statistics of one mutex.  They are only written by the thread
+  // holding the mutex, so updates are plain relaxed stores, and may be read
+  // at any time by 'snapshot'.
+  class Entry {
+    AtomicUint64 d_acquisitions;
+    AtomicUint64 d_contended;
+    AtomicUint64 d_total_wait_ns;
+    AtomicUint64 d_max_wait_ns;
+    AtomicUint64 d_hold_ns[MutexStats::NUM_HOLD_BUCKETS];
+    const char* d_name_p;
+    const void* d_mutex_p;
+    Entry* d_prev_p;
+    Entry* d_next_p;
+
+    friend class MutexRegistry;
+
+    Entry(const Entry&);
+    Entry& operator=(const Entry&);
+
+   public:
+    // Register statistics for the mutex at the specified 'mutex' address
+    // under the specified 'name', which may be 0 and otherwise must outlive
+    // this entry.
+    Entry(const char* name, const void* mutex);
+
+    // Unregister this entry.
+    ~Entry();
+
+    // Count one acquisition and return the resulting count.
+    Types::Uint64 recordAcquisition();
+
+    // Record one sampled hold of the specified 'hold_ns' nanoseconds.
+    void recordHold(Types::Uint64 hold_ns);
+
+    // Record one contended acquisition that waited the specified 'wait_ns'
+    // nanoseconds.
+    void recordWait(Types::Uint64 wait_ns);
+
+    // Load the current statistics into the specified 'stats'.
+    void read(MutexStats* stats) const;
+  };
+
+ private:
+  MutexRegistry();
+
+ public:
+  // Write a table of the statistics of every registered mutex to the
+  // specified 'stream', sorted by decreasing total wait time.
+  static void print(FILE* stream);
+
+  // Load the statistics of up to the specified 'capacity' registered
+  // mutexes into the specified 'stats' array.  Return the number of
+  // registered mutexes, which may exceed 'capacity'.
+  static int snapshot(MutexStats* stats, int capacity);
+};
+
+inline Types::Uint64 MutexRegistry::Entry::recordAcquisition() {
+  const Types::Uint64 count = d_acquisitions.loadRelaxed() + 1;
+  d_acquisitions.storeRelaxed(count);
+  return count;
+}
+
+inline void MutexRegistry::Entry::recordHold(Types::Uint64 hold_ns) {
+  int bucket = ma::AlignmentUtil::floorLog2(hold_ns | 1);
+  if (MutexStats::NUM_HOLD_BUCKETS <= bucket) {
+    bucket = MutexStats::NUM_HOLD_BUCKETS - 1;
+  }
+  d_hold_ns[bucket].storeRelaxed(d_hold_ns[bucket].loadRelaxed() + 1);
+}
+
+inline void MutexRegistry::Entry::recordWait(Types::Uint64 wait_ns) {
+  d_contended.storeRelaxed(d_contended.loadRelaxed() + 1);
+  d_total_wait_ns.storeRelaxed(d_total_wait_ns.loadRelaxed() + wait_ns);
+  if (d_max_wait_ns.loadRelaxed() < wait_ns) {
+    d_max_wait_ns.storeRelaxed(wait_ns);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_MUTEXREGISTRY_H
@@ -3,6 +3,10 @@
 
 #include "llcl/Standard/System/Platform.h"
 
+#ifdef LLCL_PLATFORM_OS_UNIX
+#include <limits.h>  // defines the '__GLIBC__' version macros on glibc
+#endif
+
 namespace llcl {
 
 namespace standard {
@@ -11,12 +15,42 @@ namespace mt {
 
 struct Platform {
   struct PosixThreads {};
+  struct FutexThreads {};
+
+#ifdef LLCL_PLATFORM_OS_LINUX
+#define LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS 1
+#endif
+
+  // Records contention statistics around the 'BaseThreadPolicy' mutex; see
+  // 'MutexRegistry'.
+  struct InstrumentedThreads {};
 
 #ifdef LLCL_PLATFORM_OS_UNIX
-  using ThreadPolicy = PosixThreads;
+  // Define 'LLCL_STANDARD_MT_USE_FUTEX_THREADS' (the CMake option
+  // 'LLCL_OPT_FUTEX_MUTEX') to back 'Mutex' with a 4-byte futex word instead
+  // of a 'pthread_mutex_t'.
+#if defined(LLCL_STANDARD_MT_USE_FUTEX_THREADS) && \
+    defined(LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS)
+  using BaseThreadPolicy = FutexThreads;
+#else
+  using BaseThreadPolicy = PosixThreads;
+#endif
+  // Define 'LLCL_STANDARD_MT_USE_INSTRUMENTED_THREADS' (the CMake option
+  // 'LLCL_OPT_INSTRUMENTED_MUTEX') to profile every 'Mutex'.
+#ifdef LLCL_STANDARD_MT_USE_INSTRUMENTED_THREADS
+  using ThreadPolicy = InstrumentedThreads;
+#else
+  using ThreadPolicy = BaseThreadPolicy;
+#endif
 #define LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS 1
 #endif
 
+  struct ReaderBiased {};
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+  using ReaderWriterPolicy = PosixThreads;
+#endif
+
   struct CountedSemaphore {};
   struct PosixSemaphore {};
 
@@ -28,6 +62,17 @@ struct Platform {
   struct PosixAdvTimedSemaphore {};
   struct PthreadTimedSemaphore {};
 
+#ifdef LLCL_PLATFORM_OS_UNIX
+  // 'sem_clockwait' appeared in glibc 2.30.
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 30))
+  using TimedSemaphorePolicy = PosixAdvTimedSemaphore;
+#define LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE 1
+#else
+  using TimedSemaphorePolicy = PthreadTimedSemaphore;
+#endif
+#endif
+
   enum {
     CACHE_LINE_SIZE = 64
   };
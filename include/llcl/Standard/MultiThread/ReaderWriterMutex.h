@@ -0,0 +1,65 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEX_H
+#define LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEX_H
+
+#include "llcl/Standard/MultiThread/ReaderWriterMutexImplPthread.h"
+#include "llcl/Standard/MultiThread/ReaderWriterMutexImplReaderBiased.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ReaderWriterMutexImpl;
+
+// 'ReaderWriterMutex' allows any number of readers ('lock_shared') or a
+// single writer ('lock') at a time, with waiting writers taking precedence
+// over new readers.  For data read from many cores at once,
+// 'ReaderWriterMutexImpl<Platform::ReaderBiased>' offers the same interface
+// with read locks that do not share a cache line between threads.
+class ReaderWriterMutex {
+  ReaderWriterMutexImpl<Platform::ReaderWriterPolicy> data_impl;
+
+  ReaderWriterMutex(const ReaderWriterMutex&);
+  ReaderWriterMutex& operator=(const ReaderWriterMutex&);
+
+ public:
+  ReaderWriterMutex();
+
+  ~ReaderWriterMutex();
+
+  void lock();
+
+  void lock_shared();
+
+  int try_lock();
+
+  int try_lock_shared();
+
+  void unlock();
+
+  void unlock_shared();
+};
+
+inline ReaderWriterMutex::ReaderWriterMutex() {}
+
+inline ReaderWriterMutex::~ReaderWriterMutex() {}
+
+inline void ReaderWriterMutex::lock() { data_impl.lock(); }
+
+inline void ReaderWriterMutex::lock_shared() { data_impl.lock_shared(); }
+
+inline int ReaderWriterMutex::try_lock() { return data_impl.try_lock(); }
+
+inline int ReaderWriterMutex::try_lock_shared() {
+  return data_impl.try_lock_shared();
+}
+
+inline void ReaderWriterMutex::unlock() { data_impl.unlock(); }
+
+inline void ReaderWriterMutex::unlock_shared() { data_impl.unlock_shared(); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEX_H
@@ -0,0 +1,87 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLPTHREAD_H
+#define LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLPTHREAD_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ReaderWriterMutexImpl;
+
+// A 'pthread_rwlock_t'.  On glibc the lock is created with
+// 'PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP', so that a waiting writer
+// blocks new readers and cannot be starved; elsewhere the platform default
+// applies.  Like the glibc kind, read locks are not recursive: a thread
+// holding one must not take another while a writer may be waiting.
+template <>
+class ReaderWriterMutexImpl<Platform::PosixThreads> {
+  pthread_rwlock_t data_lock;
+
+  ReaderWriterMutexImpl(const ReaderWriterMutexImpl&);
+  ReaderWriterMutexImpl& operator=(const ReaderWriterMutexImpl&);
+
+ public:
+  ReaderWriterMutexImpl();
+
+  ~ReaderWriterMutexImpl();
+
+  void lock();
+
+  void lock_shared();
+
+  int try_lock();
+
+  int try_lock_shared();
+
+  void unlock();
+
+  void unlock_shared();
+};
+
+inline void ReaderWriterMutexImpl<Platform::PosixThreads>::lock() {
+  const int status = pthread_rwlock_wrlock(&data_lock);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+inline void ReaderWriterMutexImpl<Platform::PosixThreads>::lock_shared() {
+  const int status = pthread_rwlock_rdlock(&data_lock);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+inline int ReaderWriterMutexImpl<Platform::PosixThreads>::try_lock() {
+  return pthread_rwlock_trywrlock(&data_lock);
+}
+
+inline int ReaderWriterMutexImpl<Platform::PosixThreads>::try_lock_shared() {
+  return pthread_rwlock_tryrdlock(&data_lock);
+}
+
+inline void ReaderWriterMutexImpl<Platform::PosixThreads>::unlock() {
+  const int status = pthread_rwlock_unlock(&data_lock);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+inline void ReaderWriterMutexImpl<Platform::PosixThreads>::unlock_shared() {
+  const int status = pthread_rwlock_unlock(&data_lock);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLPTHREAD_H
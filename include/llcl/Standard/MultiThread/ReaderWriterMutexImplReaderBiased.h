@@ -0,0 +1,143 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLREADERBIASED_H
+#define LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLREADERBIASED_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/Mutex.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class ThreadPolicy>
+class ReaderWriterMutexImpl;
+
+// A reader-writer lock for read-mostly data.  Instead of one shared reader
+// count, readers increment one of 'NUM_SLOTS' counters, each on its own
+// cache line, chosen once per thread; readers on different slots never
+// write to the same line, so read locks scale with the number of cores.  A
+// writer first takes an internal mutex, which serializes writers, then sets
+// the writer flag and waits for every slot to drain.
+//
+// Writers are preferred: a reader that finds the flag set backs out of its
+// slot and waits for the writer to finish, so new readers cannot starve a
+// pending writer.  Blocked readers sleep on a futex where available and
+// yield otherwise; a writer waiting for readers to leave spins and yields,
+// as read-side critical sections are expected to be short.  Write locks are
+// correspondingly more expensive than with a single counter, and each lock
+// occupies 'NUM_SLOTS + 1' cache lines.  Read locks are not recursive.
+template <>
+class ReaderWriterMutexImpl<Platform::ReaderBiased> {
+ public:
+  enum { NUM_SLOTS = 32 };
+
+ private:
+  enum { NO_WRITER = 0, WRITER = 1, WRITER_WITH_WAITERS = 2 };
+
+  struct alignas(Platform::CACHE_LINE_SIZE) Slot {
+    AtomicInt d_readers;
+  };
+
+  alignas(Platform::CACHE_LINE_SIZE) AtomicInt d_writer;
+  Mutex d_writer_lock;
+  Slot d_slots[NUM_SLOTS];
+
+  ReaderWriterMutexImpl(const ReaderWriterMutexImpl&);
+  ReaderWriterMutexImpl& operator=(const ReaderWriterMutexImpl&);
+
+  // Return the slot index assigned to the calling thread.
+  static int threadSlot();
+
+  // Assign a slot index to a new thread.
+  static int nextSlot();
+
+  // Wait until no writer holds or waits for the lock.
+  void waitForWriter();
+
+  // Wait until every reader slot is empty.
+  void waitForReaders();
+
+  // Clear the writer flag, waking the readers waiting on it.
+  void releaseWriter();
+
+ public:
+  ReaderWriterMutexImpl();
+
+  ~ReaderWriterMutexImpl();
+
+  void lock();
+
+  void lock_shared();
+
+  int try_lock();
+
+  int try_lock_shared();
+
+  void unlock();
+
+  void unlock_shared();
+};
+
+inline int ReaderWriterMutexImpl<Platform::ReaderBiased>::threadSlot() {
+  static thread_local int slot = -1;
+  if (slot < 0) {
+    slot = nextSlot();
+  }
+  return slot;
+}
+
+inline void ReaderWriterMutexImpl<Platform::ReaderBiased>::lock_shared() {
+  AtomicInt& readers = d_slots[threadSlot()].d_readers;
+  for (;;) {
+    // Both this increment and the writer's store to 'd_writer' are
+    // sequentially consistent, so either the writer sees the reader or the
+    // reader sees the writer.
+    readers.add(1);
+    if (NO_WRITER == d_writer.load()) {
+      return;
+    }
+    readers.subtract(1);
+    waitForWriter();
+  }
+}
+
+inline int ReaderWriterMutexImpl<Platform::ReaderBiased>::try_lock_shared() {
+  AtomicInt& readers = d_slots[threadSlot()].d_readers;
+  readers.add(1);
+  if (NO_WRITER == d_writer.load()) {
+    return 0;
+  }
+  readers.subtract(1);
+  return EBUSY;
+}
+
+inline void ReaderWriterMutexImpl<Platform::ReaderBiased>::unlock_shared() {
+  const int readers = d_slots[threadSlot()].d_readers.subtractAcqRel(1);
+  (void)readers;
+  LLCL_ASSERT_SAFE(0 <= readers);
+}
+
+inline void ReaderWriterMutexImpl<Platform::ReaderBiased>::lock() {
+  d_writer_lock.lock();
+  d_writer.store(WRITER);
+  waitForReaders();
+}
+
+inline void ReaderWriterMutexImpl<Platform::ReaderBiased>::unlock() {
+  releaseWriter();
+  d_writer_lock.unlock();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_READERWRITERMUTEXIMPLREADERBIASED_H
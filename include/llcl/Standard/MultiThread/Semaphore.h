@@ -0,0 +1,65 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SEMAPHORE_H
+#define LLCL_STANDARD_MULTITHREAD_SEMAPHORE_H
+
+#include "llcl/Standard/MultiThread/SemaphoreImplCounted.h"
+#include "llcl/Standard/MultiThread/SemaphoreImplPosix.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class SemaphorePolicy>
+class SemaphoreImpl;
+
+// 'Semaphore' is a counting semaphore using 'Platform::SemaphorePolicy'.
+// 'SemaphoreImpl<Platform::CountedSemaphore>' offers the same interface and
+// stays out of the kernel when no thread has to block.
+class Semaphore {
+  SemaphoreImpl<Platform::SemaphorePolicy> data_impl;
+
+  Semaphore(const Semaphore&);
+  Semaphore& operator=(const Semaphore&);
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count'.
+  explicit Semaphore(int count = 0);
+
+  ~Semaphore();
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number'.  This costs as much as
+  // 'number' calls to 'post' with 'Platform::PosixSemaphore', and enters the
+  // kernel only for blocked threads with 'Platform::CountedSemaphore'.
+  void post(int number);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline Semaphore::Semaphore(int count) : data_impl(count) {}
+
+inline Semaphore::~Semaphore() {}
+
+inline int Semaphore::getValue() const { return data_impl.getValue(); }
+
+inline void Semaphore::post() { data_impl.post(); }
+
+inline void Semaphore::post(int number) { data_impl.post(number); }
+
+inline int Semaphore::tryWait() { return data_impl.tryWait(); }
+
+inline void Semaphore::wait() { data_impl.wait(); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SEMAPHORE_H
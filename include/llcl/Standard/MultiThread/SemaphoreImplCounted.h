@@ -0,0 +1,108 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLCOUNTED_H
+#define LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLCOUNTED_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/SemaphoreImplPosix.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class SemaphorePolicy>
+class SemaphoreImpl;
+
+// A semaphore whose count lives in an 'AtomicInt', so that 'post' and
+// 'wait' only enter the kernel when a thread actually has to block or be
+// woken.  A negative count is the number of blocked waiters, which sleep on
+// an underlying 'sem_t'.  Before blocking, 'wait' spins for up to
+// 'SPIN_COUNT' iterations in the hope that a post is imminent.
+template <>
+class SemaphoreImpl<Platform::CountedSemaphore> {
+ public:
+  enum { SPIN_COUNT = 100 };
+
+ private:
+  AtomicInt d_count;
+  SemaphoreImpl<Platform::PosixSemaphore> d_sem;
+
+  SemaphoreImpl(const SemaphoreImpl&);
+  SemaphoreImpl& operator=(const SemaphoreImpl&);
+
+  // Spin, then block until a unit is available.
+  void waitContended();
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count'.
+  explicit SemaphoreImpl(int count = 0);
+
+  ~SemaphoreImpl();
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number' with one atomic add, and
+  // wake up to 'number' blocked threads, posting the underlying 'sem_t'
+  // once for each thread woken.
+  void post(int number);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline SemaphoreImpl<Platform::CountedSemaphore>::SemaphoreImpl(int count)
+    : d_count(count) {
+  LLCL_ASSERT_SAFE(0 <= count);
+}
+
+inline SemaphoreImpl<Platform::CountedSemaphore>::~SemaphoreImpl() {}
+
+inline int SemaphoreImpl<Platform::CountedSemaphore>::getValue() const {
+  const int count = d_count.loadRelaxed();
+  return count < 0 ? 0 : count;
+}
+
+inline void SemaphoreImpl<Platform::CountedSemaphore>::post() {
+  // A non-positive result means a waiter was blocked.
+  if (d_count.addAcqRel(1) <= 0) {
+    d_sem.post();
+  }
+}
+
+inline int SemaphoreImpl<Platform::CountedSemaphore>::tryWait() {
+  int count = d_count.loadRelaxed();
+  while (0 < count) {
+    const int prev = d_count.testAndSwapAcqRel(count, count - 1);
+    if (prev == count) {
+      return 0;
+    }
+    count = prev;
+  }
+  return EAGAIN;
+}
+
+inline void SemaphoreImpl<Platform::CountedSemaphore>::wait() {
+  if (0 != tryWait()) {
+    waitContended();
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLCOUNTED_H
@@ -0,0 +1,71 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLPOSIX_H
+#define LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLPOSIX_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+#include <errno.h>
+#include <semaphore.h>
+
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class SemaphorePolicy>
+class SemaphoreImpl;
+
+template <>
+class SemaphoreImpl<Platform::PosixSemaphore> {
+  sem_t data_sem;
+
+  SemaphoreImpl(const SemaphoreImpl&);
+  SemaphoreImpl& operator=(const SemaphoreImpl&);
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count'.
+  explicit SemaphoreImpl(int count = 0);
+
+  ~SemaphoreImpl();
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number'.
+  void post(int number);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline void SemaphoreImpl<Platform::PosixSemaphore>::post() {
+  const int status = sem_post(&data_sem);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+inline int SemaphoreImpl<Platform::PosixSemaphore>::tryWait() {
+  return sem_trywait(&data_sem);
+}
+
+inline void SemaphoreImpl<Platform::PosixSemaphore>::wait() {
+  while (0 != sem_wait(&data_sem)) {
+    LLCL_ASSERT_SAFE(EINTR == errno);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SEMAPHOREIMPLPOSIX_H
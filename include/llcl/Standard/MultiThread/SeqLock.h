@@ -0,0 +1,144 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SEQLOCK_H
+#define LLCL_STANDARD_MULTITHREAD_SEQLOCK_H
+
+#include <type_traits>
+
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/Std/cstring.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'SeqLock' holds a small trivially copyable 'TYPE' that many threads read
+// and few threads write.  A writer makes the sequence number odd, updates
+// the payload and makes it even again; a reader copies the payload between
+// two reads of the sequence number and retries if it was odd or changed.
+// Readers therefore never write to shared memory and do not slow each other
+// down, but a reader can be delayed indefinitely by a steady stream of
+// writes, and 'TYPE' is copied on every read.
+//
+// The payload is kept as an array of 'AtomicUint64' words, written with
+// release stores and read with acquire loads, so a reader racing with a
+// writer is well defined (it just retries); on x86 these are plain moves.
+// Concurrent writers are serialized by spinning on the sequence number,
+// which suits updates that are short and infrequent.
+template <class TYPE>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<TYPE>::value,
+                "'SeqLock' requires a trivially copyable type");
+
+  enum {
+    NUM_WORDS = (sizeof(TYPE) + sizeof(Types::Uint64) - 1) /
+                sizeof(Types::Uint64)
+  };
+
+  AtomicUint64 d_sequence;
+  AtomicUint64 d_words[NUM_WORDS];
+
+  SeqLock(const SeqLock&);
+  SeqLock& operator=(const SeqLock&);
+
+  // Make the sequence number odd, waiting for any other writer to finish,
+  // and return the even value it had.
+  Types::Uint64 beginWrite();
+
+ public:
+  // Create a sequence lock holding a value-initialized 'TYPE'.
+  SeqLock();
+
+  // Create a sequence lock holding the specified 'value'.
+  explicit SeqLock(const TYPE& value);
+
+  // Return a consistent copy of the current value, retrying while writers
+  // interfere.
+  TYPE load() const;
+
+  // Copy the current value into the specified 'result' and return 'true' if
+  // no writer interfered, and return 'false' otherwise.
+  bool tryLoad(TYPE* result) const;
+
+  // Replace the current value by the specified 'value'.
+  void store(const TYPE& value);
+
+  // Return the sequence number, which is even when no write is in progress
+  // and grows by 2 with each completed write.
+  Types::Uint64 sequence() const;
+};
+
+template <class TYPE>
+inline SeqLock<TYPE>::SeqLock() : SeqLock(TYPE()) {}
+
+template <class TYPE>
+inline SeqLock<TYPE>::SeqLock(const TYPE& value) {
+  Types::Uint64 words[NUM_WORDS] = {};
+  memcpy(words, &value, sizeof(TYPE));
+  for (int i = 0; i < NUM_WORDS; ++i) {
+    d_words[i].storeRelaxed(words[i]);
+  }
+}
+
+template <class TYPE>
+inline bool SeqLock<TYPE>::tryLoad(TYPE* result) const {
+  const Types::Uint64 sequence = d_sequence.loadAcquire();
+
+  // Acquire loads keep the final read of the sequence number after them;
+  // a word written by a concurrent writer synchronizes with its release
+  // store, which makes the writer's odd sequence number visible below.
+  Types::Uint64 words[NUM_WORDS];
+  for (int i = 0; i < NUM_WORDS; ++i) {
+    words[i] = d_words[i].loadAcquire();
+  }
+
+  if ((sequence & 1) || sequence != d_sequence.loadRelaxed()) {
+    return false;
+  }
+  memcpy(static_cast<void*>(result), words, sizeof(TYPE));
+  return true;
+}
+
+template <class TYPE>
+inline TYPE SeqLock<TYPE>::load() const {
+  TYPE result;
+  while (!tryLoad(&result)) {
+    SpinUtil::pause();
+  }
+  return result;
+}
+
+template <class TYPE>
+inline Types::Uint64 SeqLock<TYPE>::beginWrite() {
+  for (;;) {
+    const Types::Uint64 sequence = d_sequence.loadRelaxed();
+    if (!(sequence & 1) &&
+        sequence == d_sequence.testAndSwapAcqRel(sequence, sequence + 1)) {
+      return sequence;
+    }
+    SpinUtil::pause();
+  }
+}
+
+template <class TYPE>
+inline void SeqLock<TYPE>::store(const TYPE& value) {
+  Types::Uint64 words[NUM_WORDS] = {};
+  memcpy(words, &value, sizeof(TYPE));
+
+  const Types::Uint64 sequence = beginWrite();
+  for (int i = 0; i < NUM_WORDS; ++i) {
+    d_words[i].storeRelease(words[i]);
+  }
+  d_sequence.storeRelease(sequence + 2);
+}
+
+template <class TYPE>
+inline Types::Uint64 SeqLock<TYPE>::sequence() const {
+  return d_sequence.loadAcquire();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SEQLOCK_H
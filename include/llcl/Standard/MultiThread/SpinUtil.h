@@ -0,0 +1,60 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SPINUTIL_H
+#define LLCL_STANDARD_MULTITHREAD_SPINUTIL_H
+
+#include "llcl/Standard/System/Platform.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'SpinUtil' provides the building blocks of busy-wait loops.
+struct SpinUtil {
+  enum { YIELD_THRESHOLD = 1000 };
+
+  // Tell the CPU that the calling thread is spinning: this lowers the power
+  // drawn by the loop, yields the core to a hyper-thread sibling, and avoids
+  // the memory-order mis-speculation penalty on loop exit.
+  static void pause();
+
+  // Pause for the specified 'backoff' iterations and double 'backoff', up
+  // to the specified 'max_backoff'.
+  static void backoff(int* backoff, int max_backoff);
+
+  // Pause while the specified 'spins' count of calls made by the current
+  // busy-wait loop is below 'YIELD_THRESHOLD' (and on a multiprocessor),
+  // and yield the CPU otherwise, so that a preempted thread the loop waits
+  // for gets to run; then increment 'spins'.
+  static void pauseOrYield(int* spins);
+
+  // Return 'true' if more than one CPU was online when the process
+  // started.  On a single CPU the thread a spinning waiter waits for cannot
+  // run in the meantime, so spinning only delays blocking.
+  static bool isMultiprocessor();
+};
+
+inline void SpinUtil::pause() {
+#if defined(LLCL_PLATFORM_CPU_X86_64) || defined(LLCL_PLATFORM_CPU_X86)
+#if defined(LLCL_PLATFORM_CMP_CLANG) || defined(LLCL_PLATFORM_CMP_GNU)
+  __builtin_ia32_pause();
+#endif
+#elif defined(LLCL_PLATFORM_CPU_ARM)
+#if defined(LLCL_PLATFORM_CMP_CLANG) || defined(LLCL_PLATFORM_CMP_GNU)
+  __asm__ __volatile__("yield" ::: "memory");
+#endif
+#endif
+}
+
+inline void SpinUtil::backoff(int* backoff, int max_backoff) {
+  for (int i = 0; i < *backoff; ++i) {
+    pause();
+  }
+  if (*backoff < max_backoff) {
+    *backoff <<= 1;
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SPINUTIL_H
@@ -0,0 +1,271 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_SPSCRING_H
+#define LLCL_STANDARD_MULTITHREAD_SPSCRING_H
+
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'SpscRing' is a wait-free ring of 'TYPE' values between exactly one
+// producer thread and one consumer thread, with a power-of-two capacity.
+//
+// The producer owns the tail and the consumer the head, each on its own
+// cache line.  Next to its own index, each side keeps the last value it
+// read of the other's, and only reloads it (pulling the other side's cache
+// line over) when that stale value says the ring is full, or empty.  In a
+// steady stream most operations therefore touch no shared line but the
+// slots, and batches amortize even that: 'pushN' and 'popN' publish many
+// values with one store.  'reserve'/'commit' and 'peek'/'consume' give
+// direct access to the slots, so values can be built, or read, in place.
+//
+// Slots hold default-constructed 'TYPE' objects that are assigned to, so
+// 'TYPE' must be default-constructible and copy-assignable; a consumed
+// value stays in its slot until overwritten.
+template <class TYPE>
+class SpscRing {
+  enum { CACHE_LINE_SIZE = Platform::CACHE_LINE_SIZE };
+
+  // Consumer line.
+  AtomicUint64 d_head;
+  Types::Uint64 d_cached_tail;
+  char d_head_pad[CACHE_LINE_SIZE - sizeof(AtomicUint64) -
+                  sizeof(Types::Uint64)];
+
+  // Producer line.
+  AtomicUint64 d_tail;
+  Types::Uint64 d_cached_head;
+  char d_tail_pad[CACHE_LINE_SIZE - sizeof(AtomicUint64) -
+                  sizeof(Types::Uint64)];
+
+  TYPE* d_slots_p;
+  Types::Uint64 d_mask;
+  ma::Allocator* d_allocator_p;
+
+  SpscRing(const SpscRing&);
+  SpscRing& operator=(const SpscRing&);
+
+  // Return the number of values the consumer can read, reloading the tail
+  // if fewer than the specified 'wanted' are known to be there.
+  Types::Uint64 readable(Types::Uint64 head, Types::Uint64 wanted);
+
+  // Return the number of free slots, reloading the head if fewer than the
+  // specified 'wanted' are known to be free.
+  Types::Uint64 writable(Types::Uint64 tail, Types::Uint64 wanted);
+
+ public:
+  // Create a ring holding up to the specified positive 'capacity' values,
+  // rounded up to a power of two, using the optionally specified
+  // 'basic_allocator' (the default allocator if 0) for the slots.
+  explicit SpscRing(int capacity, ma::Allocator* basic_allocator = 0);
+
+  ~SpscRing();
+
+  // Return the number of values the ring can hold.
+  int capacity() const;
+
+  // Return the number of values in the ring, which is only a hint while
+  // the other side is running.
+  int numElements() const;
+
+  // Producer: publish the first specified 'count' slots handed out by the
+  // last 'reserve'.
+  void commit(int count);
+
+  // Consumer: release the first specified 'count' values handed out by the
+  // last 'peek'.
+  void consume(int count);
+
+  // Consumer: load the address of the oldest value into the specified
+  // 'values' and return the number, at most the specified 'count', of
+  // values stored contiguously from there.  Return 0 if the ring is empty.
+  int peek(TYPE** values, int count);
+
+  // Consumer: move up to the specified 'count' oldest values into the
+  // specified 'values' array and return how many were moved.
+  int popN(TYPE* values, int count);
+
+  // Producer: append up to the specified 'count' values of the specified
+  // 'values' array and return how many were appended.
+  int pushN(const TYPE* values, int count);
+
+  // Producer: load the address of the first free slot into the specified
+  // 'slots' and return the number, at most the specified 'count', of free
+  // slots contiguous from there.  Return 0 if the ring is full.
+  int reserve(TYPE** slots, int count);
+
+  // Consumer: move the oldest value into the specified 'value' and return
+  // 0, or return a non-zero value if the ring is empty.
+  int tryPop(TYPE* value);
+
+  // Producer: append the specified 'value' and return 0, or return a
+  // non-zero value if the ring is full.
+  int tryPush(const TYPE& value);
+};
+
+template <class TYPE>
+inline Types::Uint64 SpscRing<TYPE>::readable(Types::Uint64 head,
+                                              Types::Uint64 wanted) {
+  Types::Uint64 available = d_cached_tail - head;
+  if (available < wanted) {
+    d_cached_tail = d_tail.loadAcquire();
+    available = d_cached_tail - head;
+  }
+  return available;
+}
+
+template <class TYPE>
+inline Types::Uint64 SpscRing<TYPE>::writable(Types::Uint64 tail,
+                                              Types::Uint64 wanted) {
+  Types::Uint64 available = d_mask + 1 - (tail - d_cached_head);
+  if (available < wanted) {
+    d_cached_head = d_head.loadAcquire();
+    available = d_mask + 1 - (tail - d_cached_head);
+  }
+  return available;
+}
+
+template <class TYPE>
+SpscRing<TYPE>::SpscRing(int capacity, ma::Allocator* basic_allocator)
+    : d_head(0),
+      d_cached_tail(0),
+      d_tail(0),
+      d_cached_head(0),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < capacity);
+
+  Types::Uint64 size = 1;
+  while (size < static_cast<Types::Uint64>(capacity)) {
+    size <<= 1;
+  }
+  d_mask = size - 1;
+  d_slots_p = static_cast<TYPE*>(d_allocator_p->allocate(size * sizeof(TYPE)));
+  for (Types::Uint64 i = 0; i < size; ++i) {
+    new (d_slots_p + i) TYPE();
+  }
+}
+
+template <class TYPE>
+SpscRing<TYPE>::~SpscRing() {
+  for (Types::Uint64 i = 0; i <= d_mask; ++i) {
+    d_slots_p[i].~TYPE();
+  }
+  d_allocator_p->deallocate(d_slots_p);
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::capacity() const {
+  return static_cast<int>(d_mask + 1);
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::numElements() const {
+  const Types::Uint64 head = d_head.loadRelaxed();
+  const Types::Uint64 tail = d_tail.loadRelaxed();
+  return tail > head ? static_cast<int>(tail - head) : 0;
+}
+
+template <class TYPE>
+inline void SpscRing<TYPE>::commit(int count) {
+  LLCL_ASSERT_SAFE(0 <= count);
+  d_tail.storeRelease(d_tail.loadRelaxed() + count);
+}
+
+template <class TYPE>
+inline void SpscRing<TYPE>::consume(int count) {
+  LLCL_ASSERT_SAFE(0 <= count);
+  d_head.storeRelease(d_head.loadRelaxed() + count);
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::peek(TYPE** values, int count) {
+  const Types::Uint64 head = d_head.loadRelaxed();
+  Types::Uint64 n = readable(head, count);
+  const Types::Uint64 index = head & d_mask;
+  if (n > d_mask + 1 - index) {
+    n = d_mask + 1 - index;
+  }
+  if (n > static_cast<Types::Uint64>(count)) {
+    n = count;
+  }
+  *values = d_slots_p + index;
+  return static_cast<int>(n);
+}
+
+template <class TYPE>
+int SpscRing<TYPE>::popN(TYPE* values, int count) {
+  const Types::Uint64 head = d_head.loadRelaxed();
+  Types::Uint64 n = readable(head, count);
+  if (n > static_cast<Types::Uint64>(count)) {
+    n = count;
+  }
+  for (Types::Uint64 i = 0; i < n; ++i) {
+    values[i] = d_slots_p[(head + i) & d_mask];
+  }
+  d_head.storeRelease(head + n);
+  return static_cast<int>(n);
+}
+
+template <class TYPE>
+int SpscRing<TYPE>::pushN(const TYPE* values, int count) {
+  const Types::Uint64 tail = d_tail.loadRelaxed();
+  Types::Uint64 n = writable(tail, count);
+  if (n > static_cast<Types::Uint64>(count)) {
+    n = count;
+  }
+  for (Types::Uint64 i = 0; i < n; ++i) {
+    d_slots_p[(tail + i) & d_mask] = values[i];
+  }
+  d_tail.storeRelease(tail + n);
+  return static_cast<int>(n);
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::reserve(TYPE** slots, int count) {
+  const Types::Uint64 tail = d_tail.loadRelaxed();
+  Types::Uint64 n = writable(tail, count);
+  const Types::Uint64 index = tail & d_mask;
+  if (n > d_mask + 1 - index) {
+    n = d_mask + 1 - index;
+  }
+  if (n > static_cast<Types::Uint64>(count)) {
+    n = count;
+  }
+  *slots = d_slots_p + index;
+  return static_cast<int>(n);
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::tryPop(TYPE* value) {
+  const Types::Uint64 head = d_head.loadRelaxed();
+  if (0 == readable(head, 1)) {
+    return 1;
+  }
+  *value = d_slots_p[head & d_mask];
+  d_head.storeRelease(head + 1);
+  return 0;
+}
+
+template <class TYPE>
+inline int SpscRing<TYPE>::tryPush(const TYPE& value) {
+  const Types::Uint64 tail = d_tail.loadRelaxed();
+  if (0 == writable(tail, 1)) {
+    return 1;
+  }
+  d_slots_p[tail & d_mask] = value;
+  d_tail.storeRelease(tail + 1);
+  return 0;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_SPSCRING_H
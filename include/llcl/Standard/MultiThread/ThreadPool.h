@@ -0,0 +1,133 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_THREADPOOL_H
+#define LLCL_STANDARD_MULTITHREAD_THREADPOOL_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MultiThread/Semaphore.h"
+#include "llcl/Standard/MultiThread/WorkStealingDeque.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'ThreadPool' runs tasks on a fixed set of worker threads with work
+// stealing, for fork/join computations that spawn many fine-grained tasks.
+//
+// Every worker owns a 'WorkStealingDeque'.  A task submitted by a worker
+// goes onto its own deque, which the worker pops newest-first without
+// contention, keeping the working set in its cache.  A worker whose deque
+// is empty steals the oldest task (typically the largest piece of the
+// remaining work) of a randomly chosen victim.  Tasks submitted by other
+// threads go onto a shared lock-free list that idle workers take whole.
+// Workers that find nothing to do after 'SPIN_ROUNDS' attempts park on a
+// 'Semaphore', and a submission wakes one parked worker.
+//
+// Tasks are not copied: a 'Task' must remain valid until its job has
+// started running, and the job may then reuse or free it.  A task that
+// must wait for tasks it has spawned should call 'executePendingTask'
+// while waiting rather than block its worker.
+class ThreadPool {
+ public:
+  typedef void (*Job)(void* argument);
+
+  // A unit of work: 'd_job' is called with 'd_argument'.
+  struct Task {
+    Job d_job;
+    void* d_argument;
+    Task* d_next_p;  // used by the pool
+
+    Task();
+
+    Task(Job job, void* argument);
+  };
+
+  enum { SPIN_ROUNDS = 64 };
+
+ private:
+  struct Worker {
+    WorkStealingDeque<Task> d_deque;
+    ThreadPool* d_pool_p;
+    pthread_t d_thread;
+    unsigned d_seed;  // random victim selection
+    int d_index;
+
+    explicit Worker(ma::Allocator* basic_allocator);
+  };
+
+  Worker** d_workers_p;
+  int d_num_workers;
+  AtomicPointer<Task> d_injected;  // tasks submitted by other threads
+  AtomicInt d_num_sleepers;        // parked workers that were not woken
+  AtomicBool d_stop;
+  Semaphore d_idle_sem;
+  ma::Allocator* d_allocator_p;
+
+  ThreadPool(const ThreadPool&);
+  ThreadPool& operator=(const ThreadPool&);
+
+  static void* workerMain(void* worker);
+
+  // Return the calling thread's worker if it belongs to this pool, and 0
+  // otherwise.
+  Worker* currentWorker() const;
+
+  // Return a task for the specified 'self' from its deque, the injected
+  // tasks, or another worker, or 0 if none was found.
+  Task* findTask(Worker* self);
+
+  // Park the specified 'self' until woken, unless a task shows up; return
+  // that task, or 0.
+  Task* park(Worker* self);
+
+  void run(Worker* self);
+
+  // Steal a task from the workers other than the specified 'self' (which
+  // may be 0), starting at a random victim drawn using the specified
+  // 'seed'.  Return 0 if every deque looked empty.
+  Task* stealTask(Worker* self, unsigned* seed);
+
+  // Wake a parked worker, if any.
+  void wakeOne();
+
+ public:
+  // Create a pool of the specified positive 'num_threads' workers, using
+  // the optionally specified 'basic_allocator' (the default allocator if 0)
+  // for its bookkeeping.
+  explicit ThreadPool(int num_threads, ma::Allocator* basic_allocator = 0);
+
+  // Run the tasks still pending, then stop and join the workers.  Tasks
+  // must not be submitted by threads outside the pool during destruction.
+  ~ThreadPool();
+
+  // Run one pending task in the calling thread: from its own deque if it
+  // is a worker of this pool, otherwise stolen from a worker.  Return
+  // 'true' if a task ran.
+  bool executePendingTask();
+
+  // Return the number of worker threads.
+  int numThreads() const;
+
+  // Schedule the specified 'task'.
+  void submit(Task* task);
+};
+
+inline ThreadPool::Task::Task() : d_job(0), d_argument(0), d_next_p(0) {}
+
+inline ThreadPool::Task::Task(Job job, void* argument)
+    : d_job(job), d_argument(argument), d_next_p(0) {}
+
+inline int ThreadPool::numThreads() const { return d_num_workers; }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_THREADPOOL_H
@@ -0,0 +1,79 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_TICKETLOCK_H
+#define LLCL_STANDARD_MULTITHREAD_TICKETLOCK_H
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'TicketLock' is a FIFO spin lock: 'lock' takes the next ticket and spins
+// until the ticket is being served, and 'unlock' serves the next one.
+// Unlike a test-and-set lock, waiters never write while spinning and are
+// served in arrival order, but they all spin on the same 'now serving'
+// word, so each handoff still invalidates it in every waiter's cache.
+// Waiters pause in proportion to their distance from the head of the
+// queue, and yield the CPU after spinning for a while.
+class TicketLock {
+  alignas(Platform::CACHE_LINE_SIZE) AtomicUint d_next_ticket;
+  alignas(Platform::CACHE_LINE_SIZE) AtomicUint d_now_serving;
+
+  TicketLock(const TicketLock&);
+  TicketLock& operator=(const TicketLock&);
+
+ public:
+  TicketLock();
+
+  ~TicketLock();
+
+  void lock();
+
+  // Return 0 if the lock was acquired, and a non-zero value otherwise.
+  int try_lock();
+
+  void unlock();
+};
+
+inline TicketLock::TicketLock() : d_next_ticket(0), d_now_serving(0) {}
+
+inline TicketLock::~TicketLock() {}
+
+inline void TicketLock::lock() {
+  const unsigned ticket = d_next_ticket.addAcqRel(1) - 1;
+
+  int spins = 0;
+  for (;;) {
+    const unsigned serving = d_now_serving.loadAcquire();
+    if (serving == ticket) {
+      return;
+    }
+    for (unsigned i = 1; i < ticket - serving; ++i) {
+      SpinUtil::pause();
+    }
+    SpinUtil::pauseOrYield(&spins);
+  }
+}
+
+inline int TicketLock::try_lock() {
+  // Acquire: the compare-and-swap below only synchronizes with the last
+  // 'lock', not with the 'unlock' that published the protected data.
+  const unsigned serving = d_now_serving.loadAcquire();
+  return serving == d_next_ticket.testAndSwapAcqRel(serving, serving + 1)
+             ? 0
+             : EBUSY;
+}
+
+inline void TicketLock::unlock() {
+  // Only the owner writes 'd_now_serving'.
+  d_now_serving.storeRelease(d_now_serving.loadRelaxed() + 1);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_TICKETLOCK_H
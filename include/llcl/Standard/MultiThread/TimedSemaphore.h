@@ -0,0 +1,84 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHORE_H
+#define LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHORE_H
+
+#include "llcl/Standard/MultiThread/TimedSemaphoreImplPosixAdv.h"
+#include "llcl/Standard/MultiThread/TimedSemaphoreImplPthread.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class TimedSemaphorePolicy>
+class TimedSemaphoreImpl;
+
+// 'TimedSemaphore' is a counting semaphore that also supports waiting until
+// a deadline.  Deadlines are absolute 'timespec' values of the clock chosen
+// at construction, 'CLOCK_MONOTONIC' by default, so that changes to the
+// wall clock neither shorten nor extend a wait.  It uses 'sem_clockwait'
+// where available ('Platform::PosixAdvTimedSemaphore'), and a mutex and
+// condition variable otherwise ('Platform::PthreadTimedSemaphore').
+class TimedSemaphore {
+  TimedSemaphoreImpl<Platform::TimedSemaphorePolicy> data_impl;
+
+  TimedSemaphore(const TimedSemaphore&);
+  TimedSemaphore& operator=(const TimedSemaphore&);
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count',
+  // whose deadlines are measured against the optionally specified 'clock'
+  // ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit TimedSemaphore(int count = 0, clockid_t clock = CLOCK_MONOTONIC);
+
+  ~TimedSemaphore();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number'.
+  void post(int number);
+
+  // Block until the count is positive, then decrement it and return 0, or
+  // return 'ETIMEDOUT' once 'clockType()' reaches the specified 'deadline'.
+  int timedWait(const timespec& deadline);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline TimedSemaphore::TimedSemaphore(int count, clockid_t clock)
+    : data_impl(count, clock) {}
+
+inline TimedSemaphore::~TimedSemaphore() {}
+
+inline clockid_t TimedSemaphore::clockType() const {
+  return data_impl.clockType();
+}
+
+inline int TimedSemaphore::getValue() const { return data_impl.getValue(); }
+
+inline void TimedSemaphore::post() { data_impl.post(); }
+
+inline void TimedSemaphore::post(int number) { data_impl.post(number); }
+
+inline int TimedSemaphore::timedWait(const timespec& deadline) {
+  return data_impl.timedWait(deadline);
+}
+
+inline int TimedSemaphore::tryWait() { return data_impl.tryWait(); }
+
+inline void TimedSemaphore::wait() { data_impl.wait(); }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHORE_H
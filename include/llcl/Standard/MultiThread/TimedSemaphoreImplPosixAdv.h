@@ -0,0 +1,101 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPOSIXADV_H
+#define LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPOSIXADV_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE
+
+#include <errno.h>
+#include <semaphore.h>
+#include <time.h>
+
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class TimedSemaphorePolicy>
+class TimedSemaphoreImpl;
+
+// A 'sem_t' whose timed waits measure the deadline against a chosen clock
+// through 'sem_clockwait'.
+template <>
+class TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore> {
+  sem_t data_sem;
+  clockid_t d_clock;
+
+  TimedSemaphoreImpl(const TimedSemaphoreImpl&);
+  TimedSemaphoreImpl& operator=(const TimedSemaphoreImpl&);
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count',
+  // whose deadlines are measured against the optionally specified 'clock'
+  // ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit TimedSemaphoreImpl(int count = 0,
+                              clockid_t clock = CLOCK_MONOTONIC);
+
+  ~TimedSemaphoreImpl();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number'.
+  void post(int number);
+
+  // Block until the count is positive, then decrement it and return 0, or
+  // return 'ETIMEDOUT' once the clock reaches the specified 'deadline'.
+  int timedWait(const timespec& deadline);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline clockid_t
+TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::clockType() const {
+  return d_clock;
+}
+
+inline void TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::post() {
+  const int status = sem_post(&data_sem);
+  (void)status;
+  LLCL_ASSERT_SAFE(0 == status);
+}
+
+inline int TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::timedWait(
+    const timespec& deadline) {
+  while (0 != sem_clockwait(&data_sem, d_clock, &deadline)) {
+    if (ETIMEDOUT == errno) {
+      return ETIMEDOUT;
+    }
+    LLCL_ASSERT_SAFE(EINTR == errno);
+  }
+  return 0;
+}
+
+inline int TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::tryWait() {
+  return sem_trywait(&data_sem);
+}
+
+inline void TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::wait() {
+  while (0 != sem_wait(&data_sem)) {
+    LLCL_ASSERT_SAFE(EINTR == errno);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE
+
+#endif  // LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPOSIXADV_H
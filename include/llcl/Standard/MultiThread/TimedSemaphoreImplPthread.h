@@ -0,0 +1,80 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPTHREAD_H
+#define LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPTHREAD_H
+
+#include "llcl/Standard/MultiThread/Platform.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+#include <time.h>
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+template <class TimedSemaphorePolicy>
+class TimedSemaphoreImpl;
+
+// A count guarded by a 'pthread_mutex_t', with waiters blocking on a
+// 'pthread_cond_t' bound to the chosen clock.  Used where 'sem_clockwait'
+// is not available: 'sem_timedwait' only accepts 'CLOCK_REALTIME'
+// deadlines, which jump with the wall clock.
+template <>
+class TimedSemaphoreImpl<Platform::PthreadTimedSemaphore> {
+  pthread_mutex_t data_lock;
+  pthread_cond_t data_cond;
+  int d_count;
+  int d_num_waiters;
+  clockid_t d_clock;
+
+  TimedSemaphoreImpl(const TimedSemaphoreImpl&);
+  TimedSemaphoreImpl& operator=(const TimedSemaphoreImpl&);
+
+ public:
+  // Create a semaphore with the optionally specified initial 'count',
+  // whose deadlines are measured against the optionally specified 'clock'
+  // ('CLOCK_MONOTONIC' or 'CLOCK_REALTIME').
+  explicit TimedSemaphoreImpl(int count = 0,
+                              clockid_t clock = CLOCK_MONOTONIC);
+
+  ~TimedSemaphoreImpl();
+
+  // Return the clock deadlines are measured against.
+  clockid_t clockType() const;
+
+  // Return the current count.
+  int getValue() const;
+
+  void post();
+
+  // Increment the count by the specified 'number'.
+  void post(int number);
+
+  // Block until the count is positive, then decrement it and return 0, or
+  // return 'ETIMEDOUT' once the clock reaches the specified 'deadline'.
+  int timedWait(const timespec& deadline);
+
+  // Return 0 if the count was decremented, and a non-zero value if it was
+  // zero.
+  int tryWait();
+
+  // Block until the count is positive, then decrement it.
+  void wait();
+};
+
+inline clockid_t
+TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::clockType() const {
+  return d_clock;
+}
+
+inline void TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::post() {
+  post(1);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#endif  // LLCL_STANDARD_MULTITHREAD_TIMEDSEMAPHOREIMPLPTHREAD_H
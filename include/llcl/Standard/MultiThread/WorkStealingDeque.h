@@ -0,0 +1,196 @@
+#ifndef LLCL_STANDARD_MULTITHREAD_WORKSTEALINGDEQUE_H
+#define LLCL_STANDARD_MULTITHREAD_WORKSTEALINGDEQUE_H
+
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/Platform.h"
+#include "llcl/Standard/System/Assert.h"
+#include "llcl/Standard/System/Atomic.h"
+#include "llcl/Standard/System/Types.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+// 'WorkStealingDeque' is the Chase-Lev deque ("Dynamic Circular
+// Work-Stealing Deque", with the memory orders of Le et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models") of 'TYPE' pointers.  One
+// owner thread calls 'push' and 'pop' at the bottom end; any thread may
+// 'steal' from the top.  The owner only contends with thieves for the last
+// element, so 'push' and 'pop' are a few plain loads and stores plus one
+// sequentially consistent store.
+//
+// The circular buffer doubles when full.  Thieves may still be reading a
+// replaced buffer, so old buffers are kept until the deque is destroyed;
+// being half the size of their successor, they at most double the memory.
+template <class TYPE>
+class WorkStealingDeque {
+ public:
+  enum { INITIAL_CAPACITY = 64 };
+
+ private:
+  struct Array {
+    Types::Int64 d_mask;
+    AtomicPointer<TYPE>* d_slots_p;
+    Array* d_prev_p;  // the buffer this one replaced
+  };
+
+  AtomicInt64 d_top;
+  char d_top_pad[Platform::CACHE_LINE_SIZE - sizeof(AtomicInt64)];
+  AtomicInt64 d_bottom;
+  AtomicPointer<Array> d_array;
+  ma::Allocator* d_allocator_p;
+
+  WorkStealingDeque(const WorkStealingDeque&);
+  WorkStealingDeque& operator=(const WorkStealingDeque&);
+
+  // Return a new buffer of the specified power-of-two 'capacity'.
+  Array* createArray(Types::Int64 capacity, Array* prev);
+
+  // Replace the specified 'array', holding the elements in '[top, bottom)',
+  // with one twice its size and return it.
+  Array* grow(Array* array, Types::Int64 top, Types::Int64 bottom);
+
+ public:
+  // Create an empty deque using the optionally specified 'basic_allocator'
+  // (the default allocator if 0).
+  explicit WorkStealingDeque(ma::Allocator* basic_allocator = 0);
+
+  ~WorkStealingDeque();
+
+  // Remove and return the most recently pushed element, or 0 if the deque
+  // is empty.  Only the owner may call this.
+  TYPE* pop();
+
+  // Add the specified non-null 'item' at the bottom.  Only the owner may
+  // call this.  The store that publishes 'item' is sequentially consistent,
+  // so it is ordered before any later load by the caller.
+  void push(TYPE* item);
+
+  // Return the number of elements, which is only a hint while other
+  // threads are stealing or the owner is pushing.
+  Types::Int64 size() const;
+
+  // Remove and return the least recently pushed element, or 0 if the deque
+  // is empty or another thread won the race for that element.
+  TYPE* steal();
+};
+
+template <class TYPE>
+typename WorkStealingDeque<TYPE>::Array* WorkStealingDeque<TYPE>::createArray(
+    Types::Int64 capacity, Array* prev) {
+  Array* array = static_cast<Array*>(d_allocator_p->allocate(sizeof(Array)));
+  array->d_mask = capacity - 1;
+  array->d_slots_p = static_cast<AtomicPointer<TYPE>*>(
+      d_allocator_p->allocate(capacity * sizeof(AtomicPointer<TYPE>)));
+  for (Types::Int64 i = 0; i < capacity; ++i) {
+    new (array->d_slots_p + i) AtomicPointer<TYPE>();
+  }
+  array->d_prev_p = prev;
+  return array;
+}
+
+template <class TYPE>
+typename WorkStealingDeque<TYPE>::Array* WorkStealingDeque<TYPE>::grow(
+    Array* array, Types::Int64 top, Types::Int64 bottom) {
+  Array* bigger = createArray(2 * (array->d_mask + 1), array);
+  for (Types::Int64 i = top; i < bottom; ++i) {
+    bigger->d_slots_p[i & bigger->d_mask].storeRelaxed(
+        array->d_slots_p[i & array->d_mask].loadRelaxed());
+  }
+  d_array.storeRelease(bigger);
+  return bigger;
+}
+
+template <class TYPE>
+WorkStealingDeque<TYPE>::WorkStealingDeque(ma::Allocator* basic_allocator)
+    : d_top(0),
+      d_bottom(0),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  d_array.storeRelaxed(createArray(INITIAL_CAPACITY, 0));
+}
+
+template <class TYPE>
+WorkStealingDeque<TYPE>::~WorkStealingDeque() {
+  Array* array = d_array.loadRelaxed();
+  while (array) {
+    Array* prev = array->d_prev_p;
+    d_allocator_p->deallocate(array->d_slots_p);
+    d_allocator_p->deallocate(array);
+    array = prev;
+  }
+}
+
+template <class TYPE>
+TYPE* WorkStealingDeque<TYPE>::pop() {
+  const Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+  Array* array = d_array.loadRelaxed();
+
+  // Claim the bottom element before reading 'd_top'; a thief reads them in
+  // the opposite order, so at most one of us takes the last element
+  // without the compare-and-swap.
+  d_bottom.store(bottom);
+  const Types::Int64 top = d_top.load();
+
+  if (bottom < top) {
+    d_bottom.storeRelaxed(bottom + 1);  // empty
+    return 0;
+  }
+
+  TYPE* item = array->d_slots_p[bottom & array->d_mask].loadRelaxed();
+  if (top == bottom) {
+    // The last element: race the thieves for it.
+    if (top != d_top.testAndSwap(top, top + 1)) {
+      item = 0;
+    }
+    d_bottom.storeRelaxed(top + 1);
+  }
+  return item;
+}
+
+template <class TYPE>
+void WorkStealingDeque<TYPE>::push(TYPE* item) {
+  LLCL_ASSERT_SAFE(item);
+
+  const Types::Int64 bottom = d_bottom.loadRelaxed();
+  const Types::Int64 top = d_top.loadAcquire();
+  Array* array = d_array.loadRelaxed();
+  if (bottom - top > array->d_mask) {
+    array = grow(array, top, bottom);
+  }
+  array->d_slots_p[bottom & array->d_mask].storeRelaxed(item);
+  d_bottom.store(bottom + 1);
+}
+
+template <class TYPE>
+Types::Int64 WorkStealingDeque<TYPE>::size() const {
+  const Types::Int64 top = d_top.loadRelaxed();
+  const Types::Int64 bottom = d_bottom.loadRelaxed();
+  return bottom > top ? bottom - top : 0;
+}
+
+template <class TYPE>
+TYPE* WorkStealingDeque<TYPE>::steal() {
+  const Types::Int64 top = d_top.load();
+  const Types::Int64 bottom = d_bottom.load();
+  if (bottom <= top) {
+    return 0;
+  }
+
+  // The element must be read before the compare-and-swap releases its slot
+  // to the owner; if the swap fails, the value read is discarded.
+  Array* array = d_array.loadAcquire();
+  TYPE* item = array->d_slots_p[top & array->d_mask].loadRelaxed();
+  if (top != d_top.testAndSwap(top, top + 1)) {
+    return 0;
+  }
+  return item;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MULTITHREAD_WORKSTEALINGDEQUE_H
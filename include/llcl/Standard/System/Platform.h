@@ -3,6 +3,8 @@
 
 //@MACROS:
 //  LLCL_PLATFORM_OS_*: operating system type, sub-type, and version
+//  LLCL_PLATFORM_OS_HUGE_PAGES: 'mmap' supports explicit and transparent huge
+//                               pages
 //  LLCL_PLATFORM_CPU_*: instruction set, instruction width, and version
 //  LLCL_PLATFORM_CMP_*: compiler vendor, and version
 //  LLCL_PLATFORM_COMPILER_ERROR: trigger a compiler error
@@ -35,7 +37,8 @@ struct llcl_platform_assert;
 #define LLCL_PLATFORM_OS_AIX       1
 #define LLCL_PLATFORM_OS_VER_MAJOR _AIX
 #elif defined(__linux__)
-#define LLCL_PLATFORM_OS_LINUX 1
+#define LLCL_PLATFORM_OS_LINUX      1
+#define LLCL_PLATFORM_OS_HUGE_PAGES 1
 #else
 #error "AIX compiler appears to be in use on non-AIX OS."
 LLCL_PLATFORM_COMPILER_ERROR;
@@ -224,7 +227,8 @@ LLCL_PLATFORM_COMPILER_ERROR;
 #elif defined(__CYGWIN__) || defined(cygwin) || defined(__cygwin)
 #define LLCL_PLATFORM_OS_CYGWIN 1
 #elif defined(linux) || defined(__linux)
-#define LLCL_PLATFORM_OS_LINUX 1
+#define LLCL_PLATFORM_OS_LINUX      1
+#define LLCL_PLATFORM_OS_HUGE_PAGES 1
 #elif defined(__FreeBSD__)
 #define LLCL_PLATFORM_OS_FREEBSD 1
 #elif defined(sun) || defined(__sun)
@@ -0,0 +1,11 @@
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+Allocator::~Allocator() {}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,110 @@
+#include "llcl/Standard/MemoryAllocator/ConcurrentPool.h"
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+namespace {
+
+// Offset of the first block inside a chunk; keeps it maximally aligned.
+const Types::size_type k_header_size =
+    AlignmentUtil::roundUpToMaximalAlignment(sizeof(void*));
+
+Types::size_type internalBlockSize(Types::size_type block_size) {
+  LLCL_ASSERT(0 < block_size);
+
+  return AlignmentUtil::roundUp(block_size < sizeof(void*) ? sizeof(void*)
+                                                           : block_size,
+                                alignof(void*));
+}
+
+}  // namespace
+
+ConcurrentPool::ConcurrentPool(size_type block_size,
+                               Allocator* basic_allocator)
+    : d_head(0),
+      d_chunks_p(0),
+      d_block_size(internalBlockSize(block_size)),
+      d_blocks_per_chunk(1),
+      d_max_blocks_per_chunk(MAX_BLOCKS_PER_CHUNK),
+      d_allocator_p(Default::allocator(basic_allocator)) {}
+
+ConcurrentPool::ConcurrentPool(size_type block_size,
+                               size_type max_blocks_per_chunk,
+                               Allocator* basic_allocator)
+    : d_head(0),
+      d_chunks_p(0),
+      d_block_size(internalBlockSize(block_size)),
+      d_blocks_per_chunk(1),
+      d_max_blocks_per_chunk(max_blocks_per_chunk),
+      d_allocator_p(Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < max_blocks_per_chunk);
+}
+
+ConcurrentPool::~ConcurrentPool() { release(); }
+
+void ConcurrentPool::addChunkLocked(size_type num_blocks) {
+  Chunk* chunk = static_cast<Chunk*>(
+      d_allocator_p->allocate(k_header_size + num_blocks * d_block_size));
+  chunk->d_next_p = d_chunks_p;
+  d_chunks_p = chunk;
+
+  // Link the blocks privately in address order, then publish them with a
+  // single compare-and-swap.
+  char* first = reinterpret_cast<char*>(chunk) + k_header_size;
+  char* block = first;
+  for (size_type i = 1; i < num_blocks; ++i) {
+    reinterpret_cast<Link*>(block)->d_next.storeRelaxed(
+        reinterpret_cast<Link*>(block + d_block_size));
+    block += d_block_size;
+  }
+  pushList(reinterpret_cast<Link*>(first), reinterpret_cast<Link*>(block));
+}
+
+void ConcurrentPool::replenish() {
+  d_chunk_lock.lock();
+
+  // Another thread may have refilled the free list while we waited.
+  if (!pointer(d_head.loadAcquire())) {
+    addChunkLocked(d_blocks_per_chunk);
+
+    if (d_blocks_per_chunk < d_max_blocks_per_chunk) {
+      d_blocks_per_chunk *= 2;
+      if (d_blocks_per_chunk > d_max_blocks_per_chunk) {
+        d_blocks_per_chunk = d_max_blocks_per_chunk;
+      }
+    }
+  }
+
+  d_chunk_lock.unlock();
+}
+
+void ConcurrentPool::reserve(size_type num_blocks) {
+  if (0 == num_blocks) {
+    return;
+  }
+
+  d_chunk_lock.lock();
+  addChunkLocked(num_blocks);
+  d_chunk_lock.unlock();
+}
+
+void ConcurrentPool::release() {
+  d_chunk_lock.lock();
+  while (d_chunks_p) {
+    Chunk* next = d_chunks_p->d_next_p;
+    d_allocator_p->deallocate(d_chunks_p);
+    d_chunks_p = next;
+  }
+  d_blocks_per_chunk = 1;
+  d_chunk_lock.unlock();
+
+  d_head.storeRelease(0);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
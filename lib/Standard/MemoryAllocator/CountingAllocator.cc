@@ -0,0 +1,28 @@
+#include "llcl/Standard/MemoryAllocator/CountingAllocator.h"
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+CountingAllocator::CountingAllocator(Allocator* basic_allocator)
+    : CountingAllocator(0, basic_allocator) {}
+
+CountingAllocator::CountingAllocator(const char* name,
+                                     Allocator* basic_allocator)
+    : d_name_p(name), d_allocator_p(Default::allocator(basic_allocator)) {}
+
+CountingAllocator::~CountingAllocator() {
+  LLCL_ASSERT_SAFE(0 == d_blocks_in_use.loadRelaxed());
+}
+
+void CountingAllocator::resetPeak() {
+  d_peak_bytes_in_use.storeRelaxed(d_bytes_in_use.loadRelaxed());
+}
+
+TaggedAllocator::~TaggedAllocator() {}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,22 @@
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+AtomicPointer<Allocator> Default::s_default_allocator;
+
+Allocator* Default::defaultAllocator() {
+  Allocator* basic_allocator = s_default_allocator.loadAcquire();
+  return basic_allocator ? basic_allocator : &NewDeleteAllocator::singleton();
+}
+
+void Default::setDefaultAllocator(Allocator* basic_allocator) {
+  s_default_allocator.storeRelease(basic_allocator);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
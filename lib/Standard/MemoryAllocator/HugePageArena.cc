@@ -0,0 +1,161 @@
+#include "llcl/Standard/MemoryAllocator/HugePageArena.h"
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <new>
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+namespace {
+
+const HugePageArena::size_type k_header_size =
+    AlignmentUtil::roundUp(2 * sizeof(void*), AlignmentUtil::MAX_ALIGNMENT);
+
+// Return the start of an anonymous mapping of the specified 'size' bytes
+// with the specified extra 'flags', or 0 on failure.
+char* mapAnonymous(HugePageArena::size_type size, int flags) {
+  void* address = mmap(0, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  return MAP_FAILED == address ? 0 : static_cast<char*>(address);
+}
+
+// Return a 'HugePageArena::HUGE_PAGE_SIZE'-aligned mapping of the specified
+// 'size' bytes of normal pages, or 0 on failure.  Aligning the mapping lets
+// the kernel back all of it with transparent huge pages.
+char* mapAligned(HugePageArena::size_type size) {
+  const HugePageArena::size_type alignment = HugePageArena::HUGE_PAGE_SIZE;
+
+  char* address = mapAnonymous(size + alignment, 0);
+  if (!address) {
+    return 0;
+  }
+
+  const HugePageArena::size_type head =
+      AlignmentUtil::calculateAlignmentOffset(address, alignment);
+  if (head) {
+    munmap(address, head);
+  }
+  if (alignment != head) {
+    munmap(address + head + size, alignment - head);
+  }
+  return address + head;
+}
+
+// Write to every page of the specified 'size' bytes at 'address'.
+void prefault(char* address, HugePageArena::size_type size) {
+  const HugePageArena::size_type page_size = sysconf(_SC_PAGESIZE);
+  for (HugePageArena::size_type i = 0; i < size; i += page_size) {
+    static_cast<volatile char*>(address)[i] = 0;
+  }
+}
+
+}  // namespace
+
+HugePageArena::HugePageArena(size_type chunk_size, int flags)
+    : d_cursor_p(0),
+      d_end_p(0),
+      d_chunks_p(0),
+      d_chunk_size(AlignmentUtil::roundUp(chunk_size, HUGE_PAGE_SIZE)),
+      d_flags(flags),
+      d_bytes_locked(0) {
+  LLCL_ASSERT(0 < chunk_size);
+
+  for (int i = 0; i < NUM_PAGE_KINDS; ++i) {
+    d_bytes_mapped[i] = 0;
+  }
+}
+
+HugePageArena::~HugePageArena() { release(); }
+
+void HugePageArena::addChunk(size_type size) {
+  size = AlignmentUtil::roundUp(size, HUGE_PAGE_SIZE);
+
+  PageKind kind = NORMAL_PAGES;
+  char* address = 0;
+
+#if defined(LLCL_PLATFORM_OS_HUGE_PAGES) && defined(MAP_HUGETLB)
+  // Explicit huge pages are reserved at 'mmap' time, so populating them
+  // here cannot fail later with 'SIGBUS'.
+  address = mapAnonymous(size, MAP_HUGETLB |
+                                   (d_flags & PREFAULT ? MAP_POPULATE : 0));
+  if (address) {
+    kind = EXPLICIT_HUGE_PAGES;
+  }
+#endif
+
+  if (!address) {
+    address = mapAligned(size);
+    if (!address) {
+      throw std::bad_alloc();
+    }
+
+#if defined(LLCL_PLATFORM_OS_HUGE_PAGES) && defined(MADV_HUGEPAGE)
+    if (0 == madvise(address, size, MADV_HUGEPAGE)) {
+      kind = TRANSPARENT_HUGE_PAGES;
+    }
+#endif
+
+    // Fault in after the advice, so the pages come in huge where possible.
+    if (d_flags & PREFAULT) {
+      prefault(address, size);
+    }
+  }
+
+  if ((d_flags & LOCK) && 0 == mlock(address, size)) {
+    d_bytes_locked += size;
+  }
+
+  Chunk* chunk = reinterpret_cast<Chunk*>(address);
+  chunk->d_next_p = d_chunks_p;
+  chunk->d_size = size;
+  d_chunks_p = chunk;
+  d_bytes_mapped[kind] += size;
+
+  d_cursor_p = address + k_header_size;
+  d_end_p = address + size;
+}
+
+void* HugePageArena::allocateFromNewChunk(size_type size) {
+  const size_type needed = k_header_size + size;
+  addChunk(needed > d_chunk_size ? needed : d_chunk_size);
+
+  // The chunk payload is maximally aligned, so 'size' fits at the cursor.
+  char* result = d_cursor_p;
+  d_cursor_p += size;
+  return result;
+}
+
+void HugePageArena::reserve(size_type num_bytes) {
+  if (num_bytes <= static_cast<size_type>(d_end_p - d_cursor_p)) {
+    return;
+  }
+
+  const size_type needed = k_header_size + num_bytes;
+  addChunk(needed > d_chunk_size ? needed : d_chunk_size);
+}
+
+void HugePageArena::release() {
+  while (d_chunks_p) {
+    Chunk* chunk = d_chunks_p;
+    d_chunks_p = chunk->d_next_p;
+    munmap(chunk, chunk->d_size);
+  }
+
+  d_cursor_p = 0;
+  d_end_p = 0;
+  d_bytes_locked = 0;
+  for (int i = 0; i < NUM_PAGE_KINDS; ++i) {
+    d_bytes_mapped[i] = 0;
+  }
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_PLATFORM_OS_UNIX
@@ -0,0 +1,67 @@
+#include "llcl/Standard/MemoryAllocator/Multipool.h"
+
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+Multipool::Multipool(Allocator* basic_allocator)
+    : Multipool(DEFAULT_NUM_POOLS, Pool::MAX_BLOCKS_PER_CHUNK,
+                basic_allocator) {}
+
+Multipool::Multipool(int num_pools, size_type max_blocks_per_chunk,
+                     Allocator* basic_allocator)
+    : d_pools_p(0),
+      d_classes_p(0),
+      d_num_pools(num_pools),
+      d_max_pooled_size(static_cast<size_type>(MIN_BLOCK_SIZE)
+                        << (num_pools - 1)),
+      d_allocator_p(Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < num_pools);
+  LLCL_ASSERT(0 < max_blocks_per_chunk);
+
+  d_pools_p = static_cast<Pool*>(
+      d_allocator_p->allocate(num_pools * sizeof(Pool)));
+  for (int i = 0; i < num_pools; ++i) {
+    new (d_pools_p + i)
+        Pool(HEADER_SIZE + poolBlockSize(i), max_blocks_per_chunk,
+             d_allocator_p);
+  }
+
+  // One extra entry for the oversized requests.
+  d_classes_p = static_cast<SizeClass*>(
+      d_allocator_p->allocate((num_pools + 1) * sizeof(SizeClass)));
+  for (int i = 0; i <= num_pools; ++i) {
+    d_classes_p[i].d_num_allocations = 0;
+    d_classes_p[i].d_num_in_use = 0;
+    d_classes_p[i].d_peak_in_use = 0;
+  }
+}
+
+Multipool::~Multipool() {
+  for (int i = 0; i < d_num_pools; ++i) {
+    d_pools_p[i].~Pool();
+  }
+  d_allocator_p->deallocate(d_pools_p);
+  d_allocator_p->deallocate(d_classes_p);
+}
+
+void Multipool::reserve(size_type size, size_type num_blocks) {
+  LLCL_ASSERT(0 < size && size <= d_max_pooled_size);
+
+  d_pools_p[findPool(size)].reserve(num_blocks);
+}
+
+void Multipool::release() {
+  for (int i = 0; i < d_num_pools; ++i) {
+    d_pools_p[i].release();
+    d_classes_p[i].d_num_in_use = 0;
+  }
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,28 @@
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+#include <new>
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+NewDeleteAllocator& NewDeleteAllocator::singleton() {
+  // Never destroyed, so that objects with static storage duration can still
+  // return memory to it during program termination.
+  static NewDeleteAllocator* instance = new NewDeleteAllocator();
+  return *instance;
+}
+
+NewDeleteAllocator::~NewDeleteAllocator() {}
+
+void* NewDeleteAllocator::allocate(size_type size) {
+  return size ? ::operator new(size) : 0;
+}
+
+void NewDeleteAllocator::deallocate(void* address) {
+  ::operator delete(address);
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,105 @@
+#include "llcl/Standard/MemoryAllocator/Pool.h"
+
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+namespace {
+
+// Offset of the first block inside a chunk; keeps it maximally aligned.
+const Types::size_type k_header_size =
+    AlignmentUtil::roundUpToMaximalAlignment(sizeof(void*));
+
+// Every block must be able to hold the free-list link, and consecutive
+// blocks must keep that link aligned.
+Types::size_type internalBlockSize(Types::size_type block_size) {
+  LLCL_ASSERT(0 < block_size);
+
+  return AlignmentUtil::roundUp(block_size < sizeof(void*) ? sizeof(void*)
+                                                           : block_size,
+                                alignof(void*));
+}
+
+}  // namespace
+
+Pool::Pool(size_type block_size, Allocator* basic_allocator)
+    : d_free_list_p(0),
+      d_chunks_p(0),
+      d_block_size(internalBlockSize(block_size)),
+      d_blocks_per_chunk(1),
+      d_max_blocks_per_chunk(MAX_BLOCKS_PER_CHUNK),
+      d_allocator_p(Default::allocator(basic_allocator)) {}
+
+Pool::Pool(size_type block_size, size_type max_blocks_per_chunk,
+           Allocator* basic_allocator)
+    : d_free_list_p(0),
+      d_chunks_p(0),
+      d_block_size(internalBlockSize(block_size)),
+      d_blocks_per_chunk(1),
+      d_max_blocks_per_chunk(max_blocks_per_chunk),
+      d_allocator_p(Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < max_blocks_per_chunk);
+}
+
+Pool::~Pool() { release(); }
+
+void Pool::addChunk(size_type num_blocks) {
+  Chunk* chunk = static_cast<Chunk*>(
+      d_allocator_p->allocate(k_header_size + num_blocks * d_block_size));
+  chunk->d_next_p = d_chunks_p;
+  d_chunks_p = chunk;
+
+  // Thread the blocks back to front so that they are handed out in address
+  // order.
+  char* first = reinterpret_cast<char*>(chunk) + k_header_size;
+  char* block = first + num_blocks * d_block_size;
+  Link* head = d_free_list_p;
+  while (block != first) {
+    block -= d_block_size;
+    Link* link = reinterpret_cast<Link*>(block);
+    link->d_next_p = head;
+    head = link;
+  }
+  d_free_list_p = head;
+}
+
+void Pool::replenish() {
+  addChunk(d_blocks_per_chunk);
+
+  if (d_blocks_per_chunk < d_max_blocks_per_chunk) {
+    d_blocks_per_chunk *= 2;
+    if (d_blocks_per_chunk > d_max_blocks_per_chunk) {
+      d_blocks_per_chunk = d_max_blocks_per_chunk;
+    }
+  }
+}
+
+void Pool::reserve(size_type num_blocks) {
+  const Link* link = d_free_list_p;
+  while (link && num_blocks) {
+    link = link->d_next_p;
+    --num_blocks;
+  }
+
+  if (num_blocks) {
+    addChunk(num_blocks);
+  }
+}
+
+void Pool::release() {
+  while (d_chunks_p) {
+    Chunk* next = d_chunks_p->d_next_p;
+    d_allocator_p->deallocate(d_chunks_p);
+    d_chunks_p = next;
+  }
+
+  d_free_list_p = 0;
+  d_blocks_per_chunk = 1;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
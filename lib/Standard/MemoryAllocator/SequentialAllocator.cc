@@ -0,0 +1,118 @@
+#include "llcl/Standard/MemoryAllocator/SequentialAllocator.h"
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+namespace {
+
+// Offset of the user area inside a chunk; keeps it maximally aligned.
+const Types::size_type k_header_size =
+    AlignmentUtil::roundUpToMaximalAlignment(sizeof(void*));
+
+}  // namespace
+
+SequentialAllocator::SequentialAllocator(Allocator* basic_allocator)
+    : d_cursor_p(0),
+      d_end_p(0),
+      d_blocks_p(0),
+      d_buffer_p(0),
+      d_buffer_size(0),
+      d_initial_block_size(INITIAL_BLOCK_SIZE),
+      d_next_block_size(INITIAL_BLOCK_SIZE),
+      d_max_block_size(MAX_BLOCK_SIZE),
+      d_allocator_p(Default::allocator(basic_allocator)) {}
+
+SequentialAllocator::SequentialAllocator(size_type initial_block_size,
+                                         size_type max_block_size,
+                                         Allocator* basic_allocator)
+    : d_cursor_p(0),
+      d_end_p(0),
+      d_blocks_p(0),
+      d_buffer_p(0),
+      d_buffer_size(0),
+      d_initial_block_size(initial_block_size),
+      d_next_block_size(initial_block_size),
+      d_max_block_size(max_block_size),
+      d_allocator_p(Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < initial_block_size);
+  LLCL_ASSERT(initial_block_size <= max_block_size);
+}
+
+SequentialAllocator::SequentialAllocator(char* buffer, size_type size,
+                                         Allocator* basic_allocator)
+    : d_cursor_p(buffer),
+      d_end_p(buffer + size),
+      d_blocks_p(0),
+      d_buffer_p(buffer),
+      d_buffer_size(size),
+      d_initial_block_size(INITIAL_BLOCK_SIZE),
+      d_next_block_size(INITIAL_BLOCK_SIZE),
+      d_max_block_size(MAX_BLOCK_SIZE),
+      d_allocator_p(Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(buffer || 0 == size);
+
+  // Continue the geometric progression from the size of the buffer.
+  while (d_initial_block_size < size &&
+         d_initial_block_size < d_max_block_size) {
+    d_initial_block_size *= 2;
+  }
+  d_next_block_size = d_initial_block_size;
+}
+
+SequentialAllocator::~SequentialAllocator() { release(); }
+
+void* SequentialAllocator::allocateFromNewBlock(size_type size) {
+  if (size > d_max_block_size) {
+    // Oversized request: give it a chunk of its own and keep carving from
+    // the current one.
+    Block* block = static_cast<Block*>(
+        d_allocator_p->allocate(k_header_size + size));
+    block->d_next_p = d_blocks_p;
+    d_blocks_p = block;
+    return reinterpret_cast<char*>(block) + k_header_size;
+  }
+
+  while (d_next_block_size < size) {
+    d_next_block_size *= 2;
+  }
+  if (d_next_block_size > d_max_block_size) {
+    d_next_block_size = d_max_block_size;
+  }
+
+  const size_type block_size = d_next_block_size;
+  Block* block = static_cast<Block*>(
+      d_allocator_p->allocate(k_header_size + block_size));
+  block->d_next_p = d_blocks_p;
+  d_blocks_p = block;
+
+  if (d_next_block_size < d_max_block_size) {
+    d_next_block_size *= 2;
+    if (d_next_block_size > d_max_block_size) {
+      d_next_block_size = d_max_block_size;
+    }
+  }
+
+  char* result = reinterpret_cast<char*>(block) + k_header_size;
+  d_cursor_p = result + size;
+  d_end_p = result + block_size;
+  return result;
+}
+
+void SequentialAllocator::release() {
+  while (d_blocks_p) {
+    Block* next = d_blocks_p->d_next_p;
+    d_allocator_p->deallocate(d_blocks_p);
+    d_blocks_p = next;
+  }
+
+  d_cursor_p = d_buffer_p;
+  d_end_p = d_buffer_p + d_buffer_size;
+  d_next_block_size = d_initial_block_size;
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
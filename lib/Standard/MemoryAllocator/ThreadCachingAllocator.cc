@@ -0,0 +1,150 @@
+#include "llcl/Standard/MemoryAllocator/ThreadCachingAllocator.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/Std/cstring.h"
+
+namespace llcl {
+namespace standard {
+namespace ma {
+
+ThreadCachingAllocator::ThreadCachingAllocator(Allocator* backing_allocator)
+    : d_caches_p(0), d_backing_p(Default::allocator(backing_allocator)) {
+  const int status = pthread_key_create(&d_key, &destroyThreadCache);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator() {
+  // After this no thread-exit handler can run for this object.
+  pthread_key_delete(d_key);
+
+  d_lock.lock();
+  while (d_caches_p) {
+    destroyLocked(d_caches_p);
+  }
+  d_lock.unlock();
+}
+
+void ThreadCachingAllocator::destroyThreadCache(void* cache) {
+  ThreadCache* thread_cache = static_cast<ThreadCache*>(cache);
+  ThreadCachingAllocator* owner = thread_cache->d_owner_p;
+
+  owner->d_lock.lock();
+  owner->destroyLocked(thread_cache);
+  owner->d_lock.unlock();
+}
+
+ThreadCachingAllocator::ThreadCache*
+ThreadCachingAllocator::createThreadCache() {
+  d_lock.lock();
+  ThreadCache* cache =
+      static_cast<ThreadCache*>(d_backing_p->allocate(sizeof(ThreadCache)));
+  cache->d_owner_p = this;
+  cache->d_prev_p = 0;
+  cache->d_next_p = d_caches_p;
+  if (d_caches_p) {
+    d_caches_p->d_prev_p = cache;
+  }
+  d_caches_p = cache;
+  d_lock.unlock();
+
+  for (int i = 0; i < NUM_SIZE_CLASSES; ++i) {
+    cache->d_magazines[i].d_count = 0;
+  }
+
+  const int status = pthread_setspecific(d_key, cache);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+
+  return cache;
+}
+
+void ThreadCachingAllocator::refill(Magazine* magazine, int size_class) {
+  LLCL_ASSERT_SAFE(0 == magazine->d_count);
+
+  const size_type block_size = HEADER_SIZE + sizeClassSize(size_class);
+
+  d_lock.lock();
+  for (int i = 0; i < BATCH_SIZE; ++i) {
+    void* block = d_backing_p->allocate(block_size);
+    static_cast<Header*>(block)->d_size_class = size_class;
+    magazine->d_blocks[i] = block;
+  }
+  d_lock.unlock();
+
+  magazine->d_count = BATCH_SIZE;
+}
+
+void ThreadCachingAllocator::flush(Magazine* magazine, int num_blocks) {
+  LLCL_ASSERT_SAFE(num_blocks <= magazine->d_count);
+
+  // The oldest blocks sit at the bottom of the magazine; the most recently
+  // freed (and most likely still cached) ones stay with the thread.
+  d_lock.lock();
+  for (int i = 0; i < num_blocks; ++i) {
+    d_backing_p->deallocate(magazine->d_blocks[i]);
+  }
+  d_lock.unlock();
+
+  magazine->d_count -= num_blocks;
+  memmove(magazine->d_blocks, magazine->d_blocks + num_blocks,
+          magazine->d_count * sizeof(void*));
+}
+
+void ThreadCachingAllocator::drainLocked(ThreadCache* cache) {
+  for (int i = 0; i < NUM_SIZE_CLASSES; ++i) {
+    Magazine& magazine = cache->d_magazines[i];
+    while (magazine.d_count) {
+      d_backing_p->deallocate(magazine.d_blocks[--magazine.d_count]);
+    }
+  }
+}
+
+void ThreadCachingAllocator::destroyLocked(ThreadCache* cache) {
+  drainLocked(cache);
+
+  if (cache->d_prev_p) {
+    cache->d_prev_p->d_next_p = cache->d_next_p;
+  } else {
+    d_caches_p = cache->d_next_p;
+  }
+  if (cache->d_next_p) {
+    cache->d_next_p->d_prev_p = cache->d_prev_p;
+  }
+
+  d_backing_p->deallocate(cache);
+}
+
+void* ThreadCachingAllocator::allocateOversized(size_type size) {
+  d_lock.lock();
+  void* block = d_backing_p->allocate(HEADER_SIZE + size);
+  d_lock.unlock();
+
+  static_cast<Header*>(block)->d_size_class = OVERSIZED;
+  return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void ThreadCachingAllocator::deallocateOversized(void* block) {
+  d_lock.lock();
+  d_backing_p->deallocate(block);
+  d_lock.unlock();
+}
+
+void ThreadCachingAllocator::flushThreadCache() {
+  void* cache = pthread_getspecific(d_key);
+  if (!cache) {
+    return;
+  }
+
+  d_lock.lock();
+  drainLocked(static_cast<ThreadCache*>(cache));
+  d_lock.unlock();
+}
+
+}  // namespace ma
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
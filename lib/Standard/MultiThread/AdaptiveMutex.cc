@@ -0,0 +1,49 @@
+#include "llcl/Standard/MultiThread/AdaptiveMutex.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+void AdaptiveMutex::adapt(int spins) {
+  d_spin_budget.storeRelaxed(
+      nextSpinBudget(d_spin_budget.loadRelaxed(), spins));
+}
+
+void AdaptiveMutex::lockContended() {
+  const int max_spins = d_max_spins.loadRelaxed();
+  int limit = 2 * d_spin_budget.loadRelaxed() + 10;
+  if (limit > max_spins) {
+    limit = max_spins;
+  }
+
+  int backoff = 1;
+  for (int spins = 0; spins < limit; ++spins) {
+    SpinUtil::backoff(&backoff, MAX_BACKOFF);
+
+    // Only try the compare-and-swap once the lock looks free, so spinning
+    // waiters do not steal the cache line from the owner.
+    if (UNLOCKED == d_state.loadRelaxed() &&
+        UNLOCKED == d_state.testAndSwapAcqRel(UNLOCKED, LOCKED)) {
+      adapt(spins + 1);
+      return;
+    }
+  }
+
+  // Spinning did not pay off: spin less next time.
+  adapt(0);
+
+  // Announce a waiter, then sleep until the swap finds the word unlocked.
+  int state = d_state.swapAcqRel(CONTENDED);
+  while (UNLOCKED != state) {
+    FutexUtil::wait(&d_state, CONTENDED);
+    state = d_state.swapAcqRel(CONTENDED);
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
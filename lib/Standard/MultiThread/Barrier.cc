@@ -0,0 +1,66 @@
+#include "llcl/Standard/MultiThread/Barrier.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <limits.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+void Barrier::awaitPhase(int phase) {
+  const int max_spins = SpinUtil::isMultiprocessor() ? SPIN_COUNT : 0;
+  for (int spins = 0; spins < max_spins; ++spins) {
+    if (phase != (d_phase.loadAcquire() & ~WAITERS)) {
+      return;
+    }
+    SpinUtil::pause();
+  }
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  for (;;) {
+    const int current = d_phase.loadAcquire();
+    if (phase != (current & ~WAITERS)) {
+      return;
+    }
+    // Flag a sleeper, so that the last arrival wakes us.
+    if (!(current & WAITERS) &&
+        current != d_phase.testAndSwapAcqRel(current, current | WAITERS)) {
+      continue;
+    }
+    FutexUtil::wait(&d_phase, phase | WAITERS);
+  }
+#else
+  d_mutex.lock();
+  while (phase == (d_phase.loadAcquire() & ~WAITERS)) {
+    d_condition.wait(&d_mutex);
+  }
+  d_mutex.unlock();
+#endif
+}
+
+void Barrier::completePhase(int phase) {
+  // Let the phase number wrap around.
+  const int next =
+      static_cast<int>(static_cast<unsigned>(phase) + PHASE_INCREMENT);
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  if (d_phase.swapAcqRel(next) & WAITERS) {
+    FutexUtil::wake(&d_phase, INT_MAX);
+  }
+#else
+  d_mutex.lock();
+  d_phase.storeRelease(next);
+  d_condition.broadcast();
+  d_mutex.unlock();
+#endif
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
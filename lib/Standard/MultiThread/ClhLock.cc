@@ -0,0 +1,70 @@
+#include "llcl/Standard/MultiThread/ClhLock.h"
+
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+// The nodes owned by a thread, one per nesting level.
+struct ThreadNodes {
+  ClhLock::Node* d_nodes[ClhLock::MAX_NESTING] = {};
+  int d_depth = 0;
+
+  ~ThreadNodes() {
+    for (int i = 0; i < ClhLock::MAX_NESTING; ++i) {
+      delete d_nodes[i];
+    }
+  }
+};
+
+thread_local ThreadNodes t_nodes;
+
+}  // namespace
+
+ClhLock::ClhLock() : d_tail(new Node()), d_owner_p(0), d_pred_p(0) {}
+
+ClhLock::~ClhLock() {
+  Node* tail = d_tail.loadAcquire();
+  LLCL_ASSERT_SAFE(0 == tail->d_locked.loadRelaxed());
+
+  delete tail;
+}
+
+void ClhLock::lock() {
+  LLCL_ASSERT(t_nodes.d_depth < MAX_NESTING);
+
+  Node*& slot = t_nodes.d_nodes[t_nodes.d_depth++];
+  if (!slot) {
+    slot = new Node();
+  }
+  Node* node = slot;
+  node->d_locked.storeRelaxed(1);
+
+  Node* pred = d_tail.swapAcqRel(node);
+  int spins = 0;
+  while (pred->d_locked.loadAcquire()) {
+    SpinUtil::pauseOrYield(&spins);
+  }
+  d_owner_p = node;
+  d_pred_p = pred;
+}
+
+void ClhLock::unlock() {
+  LLCL_ASSERT_SAFE(0 < t_nodes.d_depth);
+
+  Node* node = d_owner_p;
+  LLCL_ASSERT_SAFE(node == t_nodes.d_nodes[t_nodes.d_depth - 1]);
+
+  // The predecessor's node is ours now; our node goes to the successor, or
+  // stays with the lock as its tail.
+  t_nodes.d_nodes[--t_nodes.d_depth] = d_pred_p;
+  node->d_locked.storeRelease(0);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,46 @@
+#include "llcl/Standard/MultiThread/ConditionImplFutex.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <errno.h>
+#include <limits.h>
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+void ConditionImpl<Platform::FutexThreads>::broadcast() {
+  MutexImpl<Platform::FutexThreads>* mutex = d_mutex_p.loadAcquire();
+  if (!mutex) {
+    return;  // nobody ever waited
+  }
+
+  const int sequence = d_sequence.addAcqRel(1);
+  if (0 > FutexUtil::requeue(&d_sequence, sequence, 1, &mutex->data_lock,
+                             INT_MAX)) {
+    // Another signal or broadcast changed the sequence number in between;
+    // fall back to waking everyone.
+    FutexUtil::wake(&d_sequence, INT_MAX);
+  }
+}
+
+int ConditionImpl<Platform::FutexThreads>::timedWait(
+    MutexImpl<Platform::FutexThreads>* mutex, const timespec& deadline) {
+  LLCL_ASSERT_SAFE(!d_mutex_p.loadRelaxed() ||
+                   mutex == d_mutex_p.loadRelaxed());
+
+  d_mutex_p.storeRelease(mutex);
+  const int sequence = d_sequence.loadAcquire();
+  mutex->unlock();
+  const int status =
+      FutexUtil::waitUntil(&d_sequence, sequence, deadline, d_clock);
+  const bool timed_out = 0 != status && ETIMEDOUT == errno;
+  mutex->lockRequeued();
+  return timed_out ? ETIMEDOUT : 0;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
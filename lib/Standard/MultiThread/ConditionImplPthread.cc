@@ -0,0 +1,34 @@
+#include "llcl/Standard/MultiThread/ConditionImplPthread.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+ConditionImpl<Platform::PosixThreads>::ConditionImpl(clockid_t clock)
+    : d_clock(clock) {
+  LLCL_ASSERT_SAFE(CLOCK_MONOTONIC == clock || CLOCK_REALTIME == clock);
+
+  pthread_condattr_t attr;
+  int status = pthread_condattr_init(&attr);
+  LLCL_ASSERT(0 == status);
+  status = pthread_condattr_setclock(&attr, clock);
+  LLCL_ASSERT(0 == status);
+  status = pthread_cond_init(&data_cond, &attr);
+  LLCL_ASSERT(0 == status);
+  pthread_condattr_destroy(&attr);
+  (void)status;
+}
+
+ConditionImpl<Platform::PosixThreads>::~ConditionImpl() {
+  const int status = pthread_cond_destroy(&data_cond);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
@@ -0,0 +1,195 @@
+#include "llcl/Standard/MultiThread/EpochDomain.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/CacheLineUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+EpochDomain::EpochDomain(ma::Allocator* basic_allocator)
+    : d_epoch(0),
+      d_records(0),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  const int status = pthread_key_create(&d_key, &releaseRecord);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+EpochDomain::~EpochDomain() {
+  // After this no thread-exit handler can run for this object.
+  pthread_key_delete(d_key);
+
+  Record* record = d_records.loadAcquire();
+  while (record) {
+    LLCL_ASSERT_SAFE(0 == record->d_nesting);
+
+    for (int i = 0; i < NUM_LIMBO_LISTS; ++i) {
+      deleteList(record, record->d_limbo[i].d_head_p);
+    }
+    while (record->d_free_nodes_p) {
+      Retired* node = record->d_free_nodes_p;
+      record->d_free_nodes_p = node->d_next_p;
+      d_allocator_p->deallocate(node);
+    }
+
+    Record* next = record->d_next.loadRelaxed();
+    static_cast<PaddedRecord*>(record)->~PaddedRecord();
+    CacheLineUtil::deallocate(d_allocator_p, record);
+    record = next;
+  }
+}
+
+void EpochDomain::releaseRecord(void* record) {
+  Record* thread_record = static_cast<Record*>(record);
+  EpochDomain* domain = thread_record->d_domain_p;
+
+  // Whatever is not safe yet stays with the record for 'reclaim' or its
+  // next owner.
+  domain->tryAdvance();
+  domain->collect(thread_record, domain->tryAdvance());
+  thread_record->d_in_use.storeRelease(0);
+}
+
+EpochDomain::Record* EpochDomain::acquireRecord() {
+  Record* record = d_records.loadAcquire();
+  while (record) {
+    if (0 == record->d_in_use.loadRelaxed() &&
+        0 == record->d_in_use.testAndSwapAcqRel(0, 1)) {
+      break;
+    }
+    record = record->d_next.loadAcquire();
+  }
+
+  if (!record) {
+    record = new (CacheLineUtil::allocate(d_allocator_p, sizeof(PaddedRecord)))
+        PaddedRecord();
+    record->d_state.storeRelaxed(0);
+    record->d_in_use.storeRelaxed(1);
+    record->d_domain_p = this;
+    record->d_nesting = 0;
+    record->d_num_retired = 0;
+    for (int i = 0; i < NUM_LIMBO_LISTS; ++i) {
+      record->d_limbo[i].d_epoch = 0;
+      record->d_limbo[i].d_head_p = 0;
+    }
+    record->d_free_nodes_p = 0;
+
+    Record* head = d_records.loadAcquire();
+    for (;;) {
+      record->d_next.storeRelaxed(head);
+      Record* prev = d_records.testAndSwapAcqRel(head, record);
+      if (prev == head) {
+        break;
+      }
+      head = prev;
+    }
+  }
+
+  const int status = pthread_setspecific(d_key, record);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+
+  return record;
+}
+
+void EpochDomain::deleteList(Record* record, Retired* list) {
+  while (list) {
+    Retired* node = list;
+    list = node->d_next_p;
+
+    node->d_deleter(node->d_object_p, d_allocator_p);
+    node->d_next_p = record->d_free_nodes_p;
+    record->d_free_nodes_p = node;
+  }
+}
+
+Types::Uint64 EpochDomain::tryAdvance() {
+  const Types::Uint64 epoch = d_epoch.load();
+
+  for (Record* record = d_records.loadAcquire(); record;
+       record = record->d_next.loadAcquire()) {
+    const Types::Uint64 state = record->d_state.load();
+    if ((state & ACTIVE) && (state >> 1) != epoch) {
+      return epoch;
+    }
+  }
+
+  // Losing the race means another thread advanced the epoch already.
+  const Types::Uint64 prev = d_epoch.testAndSwap(epoch, epoch + 1);
+  return prev == epoch ? epoch + 1 : prev;
+}
+
+void EpochDomain::collect(Record* record, Types::Uint64 epoch) {
+  for (int i = 0; i < NUM_LIMBO_LISTS; ++i) {
+    Limbo& limbo = record->d_limbo[i];
+    if (limbo.d_head_p && limbo.d_epoch + 2 <= epoch) {
+      Retired* list = limbo.d_head_p;
+      limbo.d_head_p = 0;
+      deleteList(record, list);
+    }
+  }
+}
+
+void EpochDomain::retireImpl(void* object, Deleter deleter) {
+  Record* record = threadRecord();
+
+  Retired* node = record->d_free_nodes_p;
+  if (node) {
+    record->d_free_nodes_p = node->d_next_p;
+  } else {
+    node = static_cast<Retired*>(d_allocator_p->allocate(sizeof(Retired)));
+  }
+  node->d_object_p = object;
+  node->d_deleter = deleter;
+
+  // The object is unreachable before this load, so no thread entering at
+  // 'epoch' or later can see it.
+  const Types::Uint64 epoch = d_epoch.load();
+  Limbo& limbo = record->d_limbo[epoch % NUM_LIMBO_LISTS];
+  if (limbo.d_epoch != epoch) {
+    // Whatever is left in this list was retired at least three epochs ago.
+    Retired* list = limbo.d_head_p;
+    limbo.d_head_p = 0;
+    limbo.d_epoch = epoch;
+    deleteList(record, list);
+  }
+  node->d_next_p = limbo.d_head_p;
+  limbo.d_head_p = node;
+
+  if (++record->d_num_retired >= RETIRE_THRESHOLD) {
+    record->d_num_retired = 0;
+    collect(record, tryAdvance());
+  }
+}
+
+void EpochDomain::reclaim() {
+  Record* record = threadRecord();
+  LLCL_ASSERT_SAFE(0 == record->d_nesting);
+
+  // Two advances make everything retired before this call safe, unless a
+  // reader is still in a critical section.
+  tryAdvance();
+  const Types::Uint64 epoch = tryAdvance();
+  collect(record, epoch);
+
+  // Also collect for the records of threads that have exited.
+  for (Record* orphan = d_records.loadAcquire(); orphan;
+       orphan = orphan->d_next.loadAcquire()) {
+    if (0 == orphan->d_in_use.loadRelaxed() &&
+        0 == orphan->d_in_use.testAndSwapAcqRel(0, 1)) {
+      collect(orphan, epoch);
+      orphan->d_in_use.storeRelease(0);
+    }
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
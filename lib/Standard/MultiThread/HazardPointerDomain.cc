@@ -0,0 +1,194 @@
+#include "llcl/Standard/MultiThread/HazardPointerDomain.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <algorithm>
+#include <new>
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/CacheLineUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+HazardPointerDomain::HazardPointerDomain(ma::Allocator* basic_allocator)
+    : d_records(0),
+      d_num_records(0),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  const int status = pthread_key_create(&d_key, &releaseRecord);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+HazardPointerDomain::~HazardPointerDomain() {
+  // After this no thread-exit handler can run for this object.
+  pthread_key_delete(d_key);
+
+  Record* record = d_records.loadAcquire();
+  while (record) {
+    LLCL_ASSERT_SAFE(0 == record->d_num_guards);
+
+    Retired* list = record->d_retired_p;
+    while (list) {
+      Retired* node = list;
+      list = node->d_next_p;
+      node->d_deleter(node->d_object_p, d_allocator_p);
+      d_allocator_p->deallocate(node);
+    }
+    while (record->d_free_nodes_p) {
+      Retired* node = record->d_free_nodes_p;
+      record->d_free_nodes_p = node->d_next_p;
+      d_allocator_p->deallocate(node);
+    }
+
+    Record* next = record->d_next.loadRelaxed();
+    static_cast<PaddedRecord*>(record)->~PaddedRecord();
+    CacheLineUtil::deallocate(d_allocator_p, record);
+    record = next;
+  }
+}
+
+void HazardPointerDomain::releaseRecord(void* record) {
+  Record* thread_record = static_cast<Record*>(record);
+
+  // Whatever is still protected stays with the record for 'reclaim' or its
+  // next owner.
+  thread_record->d_domain_p->scan(thread_record);
+  thread_record->d_in_use.storeRelease(0);
+}
+
+HazardPointerDomain::Record* HazardPointerDomain::acquireRecord() {
+  Record* record = d_records.loadAcquire();
+  while (record) {
+    if (0 == record->d_in_use.loadRelaxed() &&
+        0 == record->d_in_use.testAndSwapAcqRel(0, 1)) {
+      break;
+    }
+    record = record->d_next.loadAcquire();
+  }
+
+  if (!record) {
+    record = new (CacheLineUtil::allocate(d_allocator_p, sizeof(PaddedRecord)))
+        PaddedRecord();
+    for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+      record->d_slots[i].storeRelaxed(0);
+    }
+    record->d_in_use.storeRelaxed(1);
+    record->d_domain_p = this;
+    record->d_num_guards = 0;
+    record->d_num_retired = 0;
+    record->d_retired_p = 0;
+    record->d_free_nodes_p = 0;
+
+    Record* head = d_records.loadAcquire();
+    for (;;) {
+      record->d_next.storeRelaxed(head);
+      Record* prev = d_records.testAndSwapAcqRel(head, record);
+      if (prev == head) {
+        break;
+      }
+      head = prev;
+    }
+    d_num_records.addRelaxed(1);
+  }
+
+  const int status = pthread_setspecific(d_key, record);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+
+  return record;
+}
+
+void HazardPointerDomain::scan(Record* record) {
+  if (!record->d_retired_p) {
+    return;
+  }
+
+  // Records are only ever prepended, so walking twice from the same head
+  // visits the same records.  A record added after this snapshot cannot
+  // protect an already unlinked object: its validating reload fails.
+  Record* const head = d_records.loadAcquire();
+
+  int capacity = 0;
+  for (Record* r = head; r; r = r->d_next.loadAcquire()) {
+    capacity += SLOTS_PER_THREAD;
+  }
+
+  char** hazards =
+      static_cast<char**>(d_allocator_p->allocate(capacity * sizeof(char*)));
+  int num_hazards = 0;
+  for (Record* r = head; r; r = r->d_next.loadAcquire()) {
+    for (int i = 0; i < SLOTS_PER_THREAD; ++i) {
+      char* hazard = r->d_slots[i].load();
+      if (hazard) {
+        hazards[num_hazards++] = hazard;
+      }
+    }
+  }
+  std::sort(hazards, hazards + num_hazards);
+
+  Retired* list = record->d_retired_p;
+  record->d_retired_p = 0;
+  record->d_num_retired = 0;
+  while (list) {
+    Retired* node = list;
+    list = node->d_next_p;
+
+    if (std::binary_search(hazards, hazards + num_hazards,
+                           static_cast<char*>(node->d_object_p))) {
+      node->d_next_p = record->d_retired_p;
+      record->d_retired_p = node;
+      ++record->d_num_retired;
+    } else {
+      node->d_deleter(node->d_object_p, d_allocator_p);
+      node->d_next_p = record->d_free_nodes_p;
+      record->d_free_nodes_p = node;
+    }
+  }
+
+  d_allocator_p->deallocate(hazards);
+}
+
+void HazardPointerDomain::retireImpl(void* object, Deleter deleter) {
+  Record* record = threadRecord();
+
+  Retired* node = record->d_free_nodes_p;
+  if (node) {
+    record->d_free_nodes_p = node->d_next_p;
+  } else {
+    node = static_cast<Retired*>(d_allocator_p->allocate(sizeof(Retired)));
+  }
+  node->d_object_p = object;
+  node->d_deleter = deleter;
+  node->d_next_p = record->d_retired_p;
+  record->d_retired_p = node;
+
+  // With at most 'SLOTS_PER_THREAD * numRecords' hazards, a scan at this
+  // size frees at least half of the list.
+  const int threshold = RETIRE_THRESHOLD + 2 * SLOTS_PER_THREAD *
+                                               d_num_records.loadRelaxed();
+  if (++record->d_num_retired >= threshold) {
+    scan(record);
+  }
+}
+
+void HazardPointerDomain::reclaim() {
+  scan(threadRecord());
+
+  // Also scan the records of threads that have exited.
+  for (Record* orphan = d_records.loadAcquire(); orphan;
+       orphan = orphan->d_next.loadAcquire()) {
+    if (0 == orphan->d_in_use.loadRelaxed() &&
+        0 == orphan->d_in_use.testAndSwapAcqRel(0, 1)) {
+      scan(orphan);
+      orphan->d_in_use.storeRelease(0);
+    }
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
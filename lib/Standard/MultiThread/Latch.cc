@@ -0,0 +1,56 @@
+#include "llcl/Standard/MultiThread/Latch.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <limits.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+void Latch::release() {
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  // This happens once per latch, so there is no point in tracking whether
+  // anybody sleeps.
+  FutexUtil::wake(&d_count, INT_MAX);
+#else
+  d_mutex.lock();
+  d_condition.broadcast();
+  d_mutex.unlock();
+#endif
+}
+
+void Latch::waitContended() {
+  const int max_spins = SpinUtil::isMultiprocessor() ? SPIN_COUNT : 0;
+  for (int spins = 0; spins < max_spins; ++spins) {
+    SpinUtil::pause();
+    if (tryWait()) {
+      return;
+    }
+  }
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  // Every decrement changes the word, so a waiter may wake up (or not go to
+  // sleep) before the count reaches zero and has to check again.
+  int count = d_count.loadAcquire();
+  while (0 != count) {
+    FutexUtil::wait(&d_count, count);
+    count = d_count.loadAcquire();
+  }
+#else
+  d_mutex.lock();
+  while (!tryWait()) {
+    d_condition.wait(&d_mutex);
+  }
+  d_mutex.unlock();
+#endif
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
@@ -0,0 +1,91 @@
+#include "llcl/Standard/MultiThread/McsLock.h"
+
+#include <errno.h>
+
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+struct ThreadNodes {
+  McsLock::Node d_nodes[McsLock::MAX_NESTING];
+  int d_depth;
+};
+
+thread_local ThreadNodes t_nodes;
+
+}  // namespace
+
+McsLock::Node* McsLock::pushNode() {
+  LLCL_ASSERT(t_nodes.d_depth < MAX_NESTING);
+
+  return &t_nodes.d_nodes[t_nodes.d_depth++];
+}
+
+void McsLock::popNode() {
+  LLCL_ASSERT_SAFE(0 < t_nodes.d_depth);
+
+  --t_nodes.d_depth;
+}
+
+McsLock::McsLock() : d_tail(0), d_owner_p(0) {}
+
+McsLock::~McsLock() { LLCL_ASSERT_SAFE(0 == d_tail.loadRelaxed()); }
+
+void McsLock::lock() {
+  Node* node = pushNode();
+  node->d_next.storeRelaxed(0);
+  node->d_locked.storeRelaxed(1);
+
+  Node* pred = d_tail.swapAcqRel(node);
+  if (pred) {
+    // Link in behind the predecessor and wait for it to hand over.
+    pred->d_next.storeRelease(node);
+    int spins = 0;
+    while (node->d_locked.loadAcquire()) {
+      SpinUtil::pauseOrYield(&spins);
+    }
+  }
+  d_owner_p = node;
+}
+
+int McsLock::try_lock() {
+  Node* node = pushNode();
+  node->d_next.storeRelaxed(0);
+  if (0 != d_tail.testAndSwapAcqRel(0, node)) {
+    popNode();
+    return EBUSY;
+  }
+  d_owner_p = node;
+  return 0;
+}
+
+void McsLock::unlock() {
+  Node* node = d_owner_p;
+  LLCL_ASSERT_SAFE(node == &t_nodes.d_nodes[t_nodes.d_depth - 1]);
+
+  Node* next = node->d_next.loadAcquire();
+  if (!next) {
+    // No known successor: try to mark the queue empty.
+    if (node == d_tail.testAndSwapAcqRel(node, 0)) {
+      popNode();
+      return;
+    }
+
+    // A successor swapped itself in but has not linked in yet.
+    int spins = 0;
+    while (!(next = node->d_next.loadAcquire())) {
+      SpinUtil::pauseOrYield(&spins);
+    }
+  }
+  next->d_locked.storeRelease(0);
+  popNode();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,138 @@
+#include "llcl/Standard/MultiThread/MutexRegistry.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <pthread.h>
+
+#include <algorithm>
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+// Statically initialized, so that mutexes with static storage duration can
+// register from any translation unit.
+pthread_mutex_t k_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+MutexRegistry::Entry* k_registry_head = 0;
+
+bool hasMoreWait(const MutexStats& lhs, const MutexStats& rhs) {
+  return lhs.d_total_wait_ns > rhs.d_total_wait_ns;
+}
+
+}  // namespace
+
+Types::Uint64 MutexStats::holdPercentile(double percentile) const {
+  Types::Uint64 total = 0;
+  for (int i = 0; i < NUM_HOLD_BUCKETS; ++i) {
+    total += d_hold_ns[i];
+  }
+  if (0 == total) {
+    return 0;
+  }
+
+  const double rank = percentile / 100 * total;
+  Types::Uint64 seen = 0;
+  for (int i = 0; i < NUM_HOLD_BUCKETS - 1; ++i) {
+    seen += d_hold_ns[i];
+    if (rank <= seen) {
+      return 2ULL << i;
+    }
+  }
+  return ~0ULL;
+}
+
+MutexRegistry::Entry::Entry(const char* name, const void* mutex)
+    : d_name_p(name), d_mutex_p(mutex), d_prev_p(0) {
+  pthread_mutex_lock(&k_registry_lock);
+  d_next_p = k_registry_head;
+  if (d_next_p) {
+    d_next_p->d_prev_p = this;
+  }
+  k_registry_head = this;
+  pthread_mutex_unlock(&k_registry_lock);
+}
+
+MutexRegistry::Entry::~Entry() {
+  pthread_mutex_lock(&k_registry_lock);
+  if (d_prev_p) {
+    d_prev_p->d_next_p = d_next_p;
+  } else {
+    k_registry_head = d_next_p;
+  }
+  if (d_next_p) {
+    d_next_p->d_prev_p = d_prev_p;
+  }
+  pthread_mutex_unlock(&k_registry_lock);
+}
+
+void MutexRegistry::Entry::read(MutexStats* stats) const {
+  stats->d_name = d_name_p;
+  stats->d_mutex_p = d_mutex_p;
+  stats->d_acquisitions = d_acquisitions.loadRelaxed();
+  stats->d_contended = d_contended.loadRelaxed();
+  stats->d_total_wait_ns = d_total_wait_ns.loadRelaxed();
+  stats->d_max_wait_ns = d_max_wait_ns.loadRelaxed();
+  for (int i = 0; i < MutexStats::NUM_HOLD_BUCKETS; ++i) {
+    stats->d_hold_ns[i] = d_hold_ns[i].loadRelaxed();
+  }
+}
+
+void MutexRegistry::print(FILE* stream) {
+  ma::Allocator* allocator = ma::Default::allocator();
+
+  // Mutexes may be created between the two calls; retry until all fit.
+  int capacity = snapshot(0, 0) + 16;
+  MutexStats* stats = 0;
+  int count;
+  while (true) {
+    stats = static_cast<MutexStats*>(
+        allocator->allocate(capacity * sizeof(MutexStats)));
+    count = snapshot(stats, capacity);
+    if (count <= capacity) {
+      break;
+    }
+    allocator->deallocate(stats);
+    capacity = count + 16;
+  }
+  std::sort(stats, stats + count, &hasMoreWait);
+
+  fprintf(stream, "%-32s %12s %12s %14s %12s %12s %12s\n", "mutex",
+          "acquired", "contended", "wait_total_ns", "wait_max_ns",
+          "hold_p50_ns", "hold_p99_ns");
+  for (int i = 0; i < count; ++i) {
+    const MutexStats& s = stats[i];
+    char name[64];
+    if (s.d_name) {
+      snprintf(name, sizeof name, "%s", s.d_name);
+    } else {
+      snprintf(name, sizeof name, "%p", s.d_mutex_p);
+    }
+    fprintf(stream, "%-32s %12llu %12llu %14llu %12llu %12llu %12llu\n", name,
+            s.d_acquisitions, s.d_contended, s.d_total_wait_ns,
+            s.d_max_wait_ns, s.holdPercentile(50), s.holdPercentile(99));
+  }
+  allocator->deallocate(stats);
+}
+
+int MutexRegistry::snapshot(MutexStats* stats, int capacity) {
+  pthread_mutex_lock(&k_registry_lock);
+  int count = 0;
+  for (const Entry* entry = k_registry_head; entry;
+       entry = entry->d_next_p, ++count) {
+    if (count < capacity) {
+      entry->read(stats + count);
+    }
+  }
+  pthread_mutex_unlock(&k_registry_lock);
+  return count;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
@@ -0,0 +1,39 @@
+#include "llcl/Standard/MultiThread/ReaderWriterMutexImplPthread.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+ReaderWriterMutexImpl<Platform::PosixThreads>::ReaderWriterMutexImpl() {
+  pthread_rwlockattr_t attr;
+  int status = pthread_rwlockattr_init(&attr);
+  LLCL_ASSERT(0 == status);
+
+#ifdef __GLIBC__
+  // The glibc default prefers readers, which lets a steady stream of them
+  // starve writers.
+  status = pthread_rwlockattr_setkind_np(
+      &attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+  LLCL_ASSERT(0 == status);
+#endif
+
+  status = pthread_rwlock_init(&data_lock, &attr);
+  LLCL_ASSERT(0 == status);
+
+  pthread_rwlockattr_destroy(&attr);
+  (void)status;
+}
+
+ReaderWriterMutexImpl<Platform::PosixThreads>::~ReaderWriterMutexImpl() {
+  const int status = pthread_rwlock_destroy(&data_lock);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
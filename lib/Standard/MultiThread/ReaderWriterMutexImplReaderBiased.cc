@@ -0,0 +1,113 @@
+#include "llcl/Standard/MultiThread/ReaderWriterMutexImplReaderBiased.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <limits.h>
+#include <sched.h>
+
+#include "llcl/Standard/MultiThread/FutexUtil.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+const int k_spins_before_yield = 64;
+
+AtomicInt s_next_slot;
+
+}  // namespace
+
+ReaderWriterMutexImpl<Platform::ReaderBiased>::ReaderWriterMutexImpl()
+    : d_writer(NO_WRITER) {}
+
+ReaderWriterMutexImpl<Platform::ReaderBiased>::~ReaderWriterMutexImpl() {
+  LLCL_ASSERT_SAFE(NO_WRITER == d_writer.loadRelaxed());
+}
+
+int ReaderWriterMutexImpl<Platform::ReaderBiased>::nextSlot() {
+  // Threads are assigned slots round-robin; threads created together thus
+  // land on different cache lines.
+  return static_cast<unsigned>(s_next_slot.addRelaxed(1)) % NUM_SLOTS;
+}
+
+void ReaderWriterMutexImpl<Platform::ReaderBiased>::waitForWriter() {
+  // Write-side critical sections are usually short: spin a little before
+  // going to sleep.
+  for (int spins = 0; spins < k_spins_before_yield; ++spins) {
+    if (NO_WRITER == d_writer.loadAcquire()) {
+      return;
+    }
+    SpinUtil::pause();
+  }
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  for (;;) {
+    const int state = d_writer.loadAcquire();
+    if (NO_WRITER == state) {
+      return;
+    }
+    // Tell the writer to wake us, unless it has just left.
+    if (WRITER == state &&
+        WRITER != d_writer.testAndSwapAcqRel(WRITER, WRITER_WITH_WAITERS)) {
+      continue;
+    }
+    FutexUtil::wait(&d_writer, WRITER_WITH_WAITERS);
+  }
+#else
+  while (NO_WRITER != d_writer.loadAcquire()) {
+    sched_yield();
+  }
+#endif
+}
+
+void ReaderWriterMutexImpl<Platform::ReaderBiased>::waitForReaders() {
+  for (int i = 0; i < NUM_SLOTS; ++i) {
+    // A sequentially consistent load, to pair with the readers' increment.
+    int spins = 0;
+    while (0 != d_slots[i].d_readers.load()) {
+      if (++spins < k_spins_before_yield) {
+        SpinUtil::pause();
+      } else {
+        sched_yield();
+      }
+    }
+  }
+}
+
+void ReaderWriterMutexImpl<Platform::ReaderBiased>::releaseWriter() {
+  const int state = d_writer.swapAcqRel(NO_WRITER);
+  LLCL_ASSERT_SAFE(NO_WRITER != state);
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+  if (WRITER_WITH_WAITERS == state) {
+    FutexUtil::wake(&d_writer, INT_MAX);
+  }
+#else
+  (void)state;
+#endif
+}
+
+int ReaderWriterMutexImpl<Platform::ReaderBiased>::try_lock() {
+  if (0 != d_writer_lock.try_lock()) {
+    return EBUSY;
+  }
+
+  d_writer.store(WRITER);
+  for (int i = 0; i < NUM_SLOTS; ++i) {
+    if (0 != d_slots[i].d_readers.load()) {
+      releaseWriter();
+      d_writer_lock.unlock();
+      return EBUSY;
+    }
+  }
+  return 0;
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
@@ -0,0 +1,39 @@
+#include "llcl/Standard/MultiThread/SemaphoreImplCounted.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+void SemaphoreImpl<Platform::CountedSemaphore>::post(int number) {
+  LLCL_ASSERT_SAFE(0 <= number);
+
+  const int prev = d_count.addAcqRel(number) - number;
+  if (prev < 0) {
+    d_sem.post(-prev < number ? -prev : number);
+  }
+}
+
+void SemaphoreImpl<Platform::CountedSemaphore>::waitContended() {
+  for (int spins = 0; spins < SPIN_COUNT; ++spins) {
+    SpinUtil::pause();
+    if (0 < d_count.loadRelaxed() && 0 == tryWait()) {
+      return;
+    }
+  }
+
+  // Take a unit, going negative if there is none; a post that sees the
+  // negative count wakes us.
+  if (d_count.subtractAcqRel(1) < 0) {
+    d_sem.wait();
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
@@ -0,0 +1,43 @@
+#include "llcl/Standard/MultiThread/SemaphoreImplPosix.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+SemaphoreImpl<Platform::PosixSemaphore>::SemaphoreImpl(int count) {
+  LLCL_ASSERT_SAFE(0 <= count);
+
+  const int status = sem_init(&data_sem, 0, count);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+SemaphoreImpl<Platform::PosixSemaphore>::~SemaphoreImpl() {
+  const int status = sem_destroy(&data_sem);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+int SemaphoreImpl<Platform::PosixSemaphore>::getValue() const {
+  int value = 0;
+  sem_getvalue(const_cast<sem_t*>(&data_sem), &value);
+
+  // Some implementations report waiters as a negative value.
+  return value < 0 ? 0 : value;
+}
+
+void SemaphoreImpl<Platform::PosixSemaphore>::post(int number) {
+  LLCL_ASSERT_SAFE(0 <= number);
+
+  for (int i = 0; i < number; ++i) {
+    post();
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_SEMAPHORE
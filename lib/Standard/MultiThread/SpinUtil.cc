@@ -0,0 +1,41 @@
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+bool numCpusAboveOne() {
+#ifdef LLCL_PLATFORM_OS_UNIX
+  return 1 < sysconf(_SC_NPROCESSORS_ONLN);
+#else
+  return true;
+#endif
+}
+
+const bool k_is_multiprocessor = numCpusAboveOne();
+
+}  // namespace
+
+void SpinUtil::pauseOrYield(int* spins) {
+  if (*spins < YIELD_THRESHOLD && k_is_multiprocessor) {
+    pause();
+  } else {
+#ifdef LLCL_PLATFORM_OS_UNIX
+    sched_yield();
+#endif
+  }
+  ++*spins;
+}
+
+bool SpinUtil::isMultiprocessor() { return k_is_multiprocessor; }
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
@@ -0,0 +1,232 @@
+#include "llcl/Standard/MultiThread/ThreadPool.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+namespace {
+
+// The 'ThreadPool::Worker' run by the calling thread, if any.
+thread_local void* t_worker = 0;
+
+// The victim selection state of threads that are not workers.
+thread_local unsigned t_seed = 0;
+
+// Advance the specified xorshift 'seed' and return its new value.
+unsigned nextRandom(unsigned* seed) {
+  unsigned x = *seed ? *seed : 0x9e3779b9u;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *seed = x;
+  return x;
+}
+
+}  // namespace
+
+ThreadPool::Worker::Worker(ma::Allocator* basic_allocator)
+    : d_deque(basic_allocator) {}
+
+ThreadPool::ThreadPool(int num_threads, ma::Allocator* basic_allocator)
+    : d_num_workers(num_threads),
+      d_injected(0),
+      d_num_sleepers(0),
+      d_stop(false),
+      d_allocator_p(ma::Default::allocator(basic_allocator)) {
+  LLCL_ASSERT(0 < num_threads);
+
+  d_workers_p = static_cast<Worker**>(
+      d_allocator_p->allocate(num_threads * sizeof(Worker*)));
+  for (int i = 0; i < num_threads; ++i) {
+    Worker* worker = new (*d_allocator_p) Worker(d_allocator_p);
+    worker->d_pool_p = this;
+    worker->d_seed = 2654435761u * (i + 1);
+    worker->d_index = i;
+    d_workers_p[i] = worker;
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    const int status = pthread_create(&d_workers_p[i]->d_thread, 0,
+                                      &workerMain, d_workers_p[i]);
+    (void)status;
+    LLCL_ASSERT(0 == status);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  d_stop.store(true);
+  d_idle_sem.post(d_num_workers);
+  for (int i = 0; i < d_num_workers; ++i) {
+    pthread_join(d_workers_p[i]->d_thread, 0);
+  }
+  LLCL_ASSERT_SAFE(0 == d_injected.loadRelaxed());
+
+  for (int i = 0; i < d_num_workers; ++i) {
+    d_allocator_p->deleteObject(d_workers_p[i]);
+  }
+  d_allocator_p->deallocate(d_workers_p);
+}
+
+void* ThreadPool::workerMain(void* worker) {
+  Worker* self = static_cast<Worker*>(worker);
+  t_worker = self;
+  self->d_pool_p->run(self);
+  return 0;
+}
+
+ThreadPool::Worker* ThreadPool::currentWorker() const {
+  Worker* worker = static_cast<Worker*>(t_worker);
+  return worker && this == worker->d_pool_p ? worker : 0;
+}
+
+ThreadPool::Task* ThreadPool::findTask(Worker* self) {
+  Task* task = self->d_deque.pop();
+  if (task) {
+    return task;
+  }
+
+  // Take all injected tasks.  The list is newest first: push all but the
+  // oldest, which runs now, so that the others can be stolen.  A task may
+  // run as soon as it is pushed, so its link is read before.
+  if (d_injected.load()) {
+    task = d_injected.swapAcqRel(0);
+    if (task) {
+      if (task->d_next_p) {
+        while (Task* next = task->d_next_p) {
+          self->d_deque.push(task);
+          task = next;
+        }
+        wakeOne();
+      }
+      return task;
+    }
+  }
+
+  return stealTask(self, &self->d_seed);
+}
+
+ThreadPool::Task* ThreadPool::park(Worker* self) {
+  // Announce the worker as a sleeper before looking for work one last time:
+  // a task submitted concurrently is either found here, or its submitter
+  // sees the sleeper and wakes it.
+  d_num_sleepers.add(1);
+
+  Task* task = findTask(self);
+  if (!task && !d_stop.load()) {
+    d_idle_sem.wait();
+    return 0;
+  }
+
+  // Withdraw the announcement, unless a submitter already claimed it, in
+  // which case its wake-up must be consumed.
+  int sleepers = d_num_sleepers.loadRelaxed();
+  while (0 < sleepers) {
+    const int prev = d_num_sleepers.testAndSwap(sleepers, sleepers - 1);
+    if (prev == sleepers) {
+      return task;
+    }
+    sleepers = prev;
+  }
+  d_idle_sem.wait();
+  return task;
+}
+
+void ThreadPool::run(Worker* self) {
+  const int spin_rounds = SpinUtil::isMultiprocessor() ? SPIN_ROUNDS : 0;
+  int idle_rounds = 0;
+  while (true) {
+    Task* task = findTask(self);
+    if (!task) {
+      if (idle_rounds < spin_rounds) {
+        ++idle_rounds;
+        SpinUtil::pause();
+        continue;
+      }
+      idle_rounds = 0;
+      if (d_stop.load()) {
+        // Anything submitted before the pool was stopped is visible now.
+        task = findTask(self);
+        if (!task) {
+          return;
+        }
+      } else {
+        task = park(self);
+        if (!task) {
+          continue;
+        }
+      }
+    }
+    idle_rounds = 0;
+    task->d_job(task->d_argument);
+  }
+}
+
+ThreadPool::Task* ThreadPool::stealTask(Worker* self, unsigned* seed) {
+  int victim = nextRandom(seed) % d_num_workers;
+  for (int i = 0; i < d_num_workers; ++i) {
+    Worker* worker = d_workers_p[victim];
+    if (worker != self) {
+      Task* task = worker->d_deque.steal();
+      if (task) {
+        return task;
+      }
+    }
+    if (++victim == d_num_workers) {
+      victim = 0;
+    }
+  }
+  return 0;
+}
+
+void ThreadPool::wakeOne() {
+  int sleepers = d_num_sleepers.load();
+  while (0 < sleepers) {
+    const int prev = d_num_sleepers.testAndSwap(sleepers, sleepers - 1);
+    if (prev == sleepers) {
+      d_idle_sem.post();
+      return;
+    }
+    sleepers = prev;
+  }
+}
+
+bool ThreadPool::executePendingTask() {
+  Worker* self = currentWorker();
+  Task* task = self ? findTask(self) : stealTask(0, &t_seed);
+  if (!task) {
+    return false;
+  }
+  task->d_job(task->d_argument);
+  return true;
+}
+
+void ThreadPool::submit(Task* task) {
+  LLCL_ASSERT_SAFE(task && task->d_job);
+
+  Worker* self = currentWorker();
+  if (self) {
+    self->d_deque.push(task);
+  } else {
+    Task* head = d_injected.loadRelaxed();
+    for (;;) {
+      task->d_next_p = head;
+      Task* prev = d_injected.testAndSwap(head, task);
+      if (prev == head) {
+        break;
+      }
+      head = prev;
+    }
+  }
+  wakeOne();
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
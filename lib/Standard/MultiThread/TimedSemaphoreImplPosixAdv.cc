@@ -0,0 +1,44 @@
+#include "llcl/Standard/MultiThread/TimedSemaphoreImplPosixAdv.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::TimedSemaphoreImpl(
+    int count, clockid_t clock)
+    : d_clock(clock) {
+  LLCL_ASSERT_SAFE(0 <= count);
+  LLCL_ASSERT_SAFE(CLOCK_MONOTONIC == clock || CLOCK_REALTIME == clock);
+
+  const int status = sem_init(&data_sem, 0, count);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::~TimedSemaphoreImpl() {
+  const int status = sem_destroy(&data_sem);
+  (void)status;
+  LLCL_ASSERT(0 == status);
+}
+
+int TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::getValue() const {
+  int value = 0;
+  sem_getvalue(const_cast<sem_t*>(&data_sem), &value);
+  return value < 0 ? 0 : value;
+}
+
+void TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>::post(int number) {
+  LLCL_ASSERT_SAFE(0 <= number);
+
+  for (int i = 0; i < number; ++i) {
+    post();
+  }
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE
@@ -0,0 +1,115 @@
+#include "llcl/Standard/MultiThread/TimedSemaphoreImplPthread.h"
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
+
+#include <errno.h>
+
+#include "llcl/Standard/System/Assert.h"
+
+namespace llcl {
+namespace standard {
+namespace mt {
+
+TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::TimedSemaphoreImpl(
+    int count, clockid_t clock)
+    : d_count(count), d_num_waiters(0), d_clock(clock) {
+  LLCL_ASSERT_SAFE(0 <= count);
+  LLCL_ASSERT_SAFE(CLOCK_MONOTONIC == clock || CLOCK_REALTIME == clock);
+
+  int status = pthread_mutex_init(&data_lock, 0);
+  LLCL_ASSERT(0 == status);
+
+  pthread_condattr_t attr;
+  status = pthread_condattr_init(&attr);
+  LLCL_ASSERT(0 == status);
+  status = pthread_condattr_setclock(&attr, clock);
+  LLCL_ASSERT(0 == status);
+  status = pthread_cond_init(&data_cond, &attr);
+  LLCL_ASSERT(0 == status);
+  pthread_condattr_destroy(&attr);
+  (void)status;
+}
+
+TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::~TimedSemaphoreImpl() {
+  LLCL_ASSERT_SAFE(0 == d_num_waiters);
+
+  int status = pthread_cond_destroy(&data_cond);
+  LLCL_ASSERT(0 == status);
+  status = pthread_mutex_destroy(&data_lock);
+  LLCL_ASSERT(0 == status);
+  (void)status;
+}
+
+int TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::getValue() const {
+  pthread_mutex_t* lock = const_cast<pthread_mutex_t*>(&data_lock);
+  pthread_mutex_lock(lock);
+  const int count = d_count;
+  pthread_mutex_unlock(lock);
+  return count;
+}
+
+void TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::post(int number) {
+  LLCL_ASSERT_SAFE(0 <= number);
+
+  pthread_mutex_lock(&data_lock);
+  d_count += number;
+  const int num_waiters = d_num_waiters;
+  pthread_mutex_unlock(&data_lock);
+
+  // A thread that starts waiting after the unlock sees the new count, and
+  // one counted before is already blocked on the condition.
+  if (0 == number || 0 == num_waiters) {
+    return;
+  }
+  if (1 == number || 1 == num_waiters) {
+    pthread_cond_signal(&data_cond);
+  } else {
+    pthread_cond_broadcast(&data_cond);
+  }
+}
+
+int TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::timedWait(
+    const timespec& deadline) {
+  pthread_mutex_lock(&data_lock);
+  ++d_num_waiters;
+  while (0 == d_count) {
+    const int status =
+        pthread_cond_timedwait(&data_cond, &data_lock, &deadline);
+    if (ETIMEDOUT == status && 0 == d_count) {
+      --d_num_waiters;
+      pthread_mutex_unlock(&data_lock);
+      return ETIMEDOUT;
+    }
+  }
+  --d_num_waiters;
+  --d_count;
+  pthread_mutex_unlock(&data_lock);
+  return 0;
+}
+
+int TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::tryWait() {
+  pthread_mutex_lock(&data_lock);
+  const int count = d_count;
+  if (0 < count) {
+    --d_count;
+  }
+  pthread_mutex_unlock(&data_lock);
+  return 0 < count ? 0 : EAGAIN;
+}
+
+void TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>::wait() {
+  pthread_mutex_lock(&data_lock);
+  ++d_num_waiters;
+  while (0 == d_count) {
+    pthread_cond_wait(&data_cond, &data_lock);
+  }
+  --d_num_waiters;
+  --d_count;
+  pthread_mutex_unlock(&data_lock);
+}
+
+}  // namespace mt
+}  // namespace standard
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_POSIX_THREADS
@@ -110,6 +110,23 @@ TEST(IListNodeBaseTest, setPrevAndNext) {
   EXPECT_EQ(nullptr, PTC.getNext());
 }
 
+TEST(IListNodeBaseTest, atomicNext) {
+  RawNode A, B;
+  A.setPrev(&B);
+  A.setNextRelease(&B);
+  EXPECT_EQ(&B, A.getNext());
+  EXPECT_EQ(&B, A.getNextAcquire());
+  EXPECT_EQ(&B, A.getPrev());
+
+  TrackingNode TA, TB;
+  TA.initializeSentinel();
+  TA.setNextRelease(&TB);
+  EXPECT_EQ(&TB, TA.getNextAcquire());
+  EXPECT_TRUE(TA.isSentinel());
+  TA.setNext(nullptr);
+  EXPECT_EQ(nullptr, TA.getNextAcquire());
+}
+
 TEST(IListNodeBaseTest, isKnownSentinel) {
   // Without sentinel tracking.
   RawNode A, B;
@@ -0,0 +1,43 @@
+#include "llcl/Standard/MemoryAllocator/AlignmentUtil.h"
+
+#include <gtest/gtest.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::AlignmentUtil;
+
+TEST(AlignmentUtilTest, Log2) {
+  EXPECT_EQ(0, AlignmentUtil::floorLog2(1));
+  EXPECT_EQ(1, AlignmentUtil::floorLog2(2));
+  EXPECT_EQ(1, AlignmentUtil::floorLog2(3));
+  EXPECT_EQ(10, AlignmentUtil::floorLog2(1024));
+  EXPECT_EQ(10, AlignmentUtil::floorLog2(2047));
+  EXPECT_EQ(63, AlignmentUtil::floorLog2(~AlignmentUtil::size_type(0)));
+
+  EXPECT_EQ(0, AlignmentUtil::ceilLog2(1));
+  EXPECT_EQ(1, AlignmentUtil::ceilLog2(2));
+  EXPECT_EQ(2, AlignmentUtil::ceilLog2(3));
+  EXPECT_EQ(10, AlignmentUtil::ceilLog2(1024));
+  EXPECT_EQ(11, AlignmentUtil::ceilLog2(1025));
+}
+
+TEST(AlignmentUtilTest, Alignment) {
+  EXPECT_EQ(1u, AlignmentUtil::calculateAlignmentFromSize(7));
+  EXPECT_EQ(4u, AlignmentUtil::calculateAlignmentFromSize(12));
+  EXPECT_EQ(static_cast<AlignmentUtil::size_type>(AlignmentUtil::MAX_ALIGNMENT),
+            AlignmentUtil::calculateAlignmentFromSize(1024));
+
+  char buffer[64];
+  char* address = buffer + 1;
+  const AlignmentUtil::size_type offset =
+      AlignmentUtil::calculateAlignmentOffset(address, 32);
+  EXPECT_GT(32u, offset);
+  EXPECT_EQ(0u, AlignmentUtil::calculateAlignmentOffset(address + offset, 32));
+
+  EXPECT_EQ(64u, AlignmentUtil::roundUp(33, 32));
+  EXPECT_EQ(32u, AlignmentUtil::roundUp(32, 32));
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,121 @@
+#include "llcl/Standard/MemoryAllocator/Allocator.h"
+
+#include <gtest/gtest.h>
+
+#include "llcl/Standard/MemoryAllocator/Default.h"
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::Default;
+using llcl::standard::ma::NewDeleteAllocator;
+
+class my_RecordingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+  void* d_last_allocated = 0;
+  void* d_last_deallocated = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    d_last_allocated = ::operator new(size);
+    return d_last_allocated;
+  }
+
+  void deallocate(void* address) override {
+    if (!address) {
+      return;
+    }
+    ++d_num_deallocations;
+    d_last_deallocated = address;
+    ::operator delete(address);
+  }
+};
+
+int g_destroyed = 0;
+
+struct Plain {
+  int d_value;
+  ~Plain() { ++g_destroyed; }
+};
+
+struct LeftBase {
+  int d_left = 1;
+  virtual ~LeftBase() { ++g_destroyed; }
+};
+
+struct RightBase {
+  int d_right = 2;
+  virtual ~RightBase() { ++g_destroyed; }
+};
+
+struct MostDerived : LeftBase, RightBase {
+  int d_derived = 3;
+  ~MostDerived() override { ++g_destroyed; }
+};
+
+TEST(AllocatorTest, NewDeleteAllocator) {
+  NewDeleteAllocator& allocator = NewDeleteAllocator::singleton();
+  EXPECT_EQ(&allocator, &NewDeleteAllocator::singleton());
+
+  EXPECT_EQ(nullptr, allocator.allocate(0));
+  allocator.deallocate(0);
+
+  void* address = allocator.allocate(100);
+  ASSERT_NE(nullptr, address);
+  EXPECT_EQ(0u, reinterpret_cast<standard::Types::UintPtr>(address) %
+                    Allocator::MAX_ALIGNMENT);
+  allocator.deallocate(address);
+}
+
+TEST(AllocatorTest, Default) {
+  my_RecordingAllocator recorder;
+
+  EXPECT_EQ(&NewDeleteAllocator::singleton(), Default::defaultAllocator());
+  EXPECT_EQ(&recorder, Default::allocator(&recorder));
+  EXPECT_EQ(Default::defaultAllocator(), Default::allocator());
+
+  Default::setDefaultAllocator(&recorder);
+  EXPECT_EQ(&recorder, Default::defaultAllocator());
+  EXPECT_EQ(&recorder, Default::allocator(0));
+
+  Default::setDefaultAllocator(0);
+  EXPECT_EQ(&NewDeleteAllocator::singleton(), Default::defaultAllocator());
+}
+
+TEST(AllocatorTest, DeleteObjectPlain) {
+  my_RecordingAllocator allocator;
+  g_destroyed = 0;
+
+  Plain* object = new (allocator) Plain();
+  EXPECT_EQ(1, allocator.d_num_allocations);
+
+  allocator.deleteObject(object);
+  EXPECT_EQ(1, g_destroyed);
+  EXPECT_EQ(1, allocator.d_num_deallocations);
+  EXPECT_EQ(allocator.d_last_allocated, allocator.d_last_deallocated);
+
+  allocator.deleteObject(static_cast<Plain*>(0));
+  EXPECT_EQ(1, g_destroyed);
+  EXPECT_EQ(1, allocator.d_num_deallocations);
+}
+
+TEST(AllocatorTest, DeleteObjectThroughSecondaryBase) {
+  my_RecordingAllocator allocator;
+  g_destroyed = 0;
+
+  MostDerived* object = new (allocator) MostDerived();
+  RightBase* base = object;
+  ASSERT_NE(static_cast<void*>(object), static_cast<void*>(base));
+
+  allocator.deleteObjectRaw(base);
+  EXPECT_EQ(3, g_destroyed);
+  EXPECT_EQ(1, allocator.d_num_deallocations);
+  EXPECT_EQ(allocator.d_last_allocated, allocator.d_last_deallocated);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,70 @@
+#include "llcl/Standard/MemoryAllocator/BufferedSequentialAllocator.h"
+
+#include <gtest/gtest.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::BufferedSequentialAllocator;
+using llcl::standard::Types;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+struct my_Point {
+  double d_x;
+  double d_y;
+};
+
+TEST(BufferedSequentialAllocatorTest, InlineThenUpstream) {
+  my_CountingAllocator upstream;
+  {
+    BufferedSequentialAllocator<256> allocator(&upstream);
+    const char* begin = reinterpret_cast<const char*>(&allocator);
+    const char* end = begin + sizeof allocator;
+
+    void* first = allocator.allocate(1);
+    EXPECT_TRUE(begin <= static_cast<char*>(first));
+    allocator.release();
+    EXPECT_EQ(first, allocator.allocate(1));
+
+    for (int i = 0; i < 15; ++i) {
+      my_Point* point = new (allocator) my_Point();
+      const char* address = reinterpret_cast<const char*>(point);
+      EXPECT_TRUE(begin <= address && address < end);
+      EXPECT_EQ(0u, reinterpret_cast<Types::UintPtr>(point) % 8);
+      allocator.deleteObject(point);
+    }
+    EXPECT_EQ(0, upstream.d_num_allocations);
+
+    void* address = allocator.allocate(16);
+    EXPECT_TRUE(static_cast<char*>(address) < begin ||
+                end <= static_cast<char*>(address));
+    EXPECT_EQ(1, upstream.d_num_allocations);
+
+    allocator.release();
+    EXPECT_EQ(1, upstream.d_num_deallocations);
+    EXPECT_EQ(first, allocator.allocate(1));
+
+    allocator.allocate(1000);
+    EXPECT_EQ(2, upstream.d_num_allocations);
+  }
+  EXPECT_EQ(2, upstream.d_num_deallocations);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,127 @@
+#include "llcl/Standard/MemoryAllocator/ConcurrentPool.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include <set>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::ConcurrentPool;
+using llcl::standard::Types;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+TEST(ConcurrentPoolTest, SingleThread) {
+  my_CountingAllocator upstream;
+  {
+    ConcurrentPool pool(40, &upstream);
+    EXPECT_EQ(40u, pool.blockSize());
+
+    std::set<void*> blocks;
+    for (int i = 0; i < 500; ++i) {
+      void* block = pool.allocate();
+      EXPECT_EQ(0u, reinterpret_cast<Types::UintPtr>(block) % 8);
+      EXPECT_TRUE(blocks.insert(block).second);
+    }
+    const int num_chunks = upstream.d_num_allocations;
+
+    for (std::set<void*>::iterator it = blocks.begin(); it != blocks.end();
+         ++it) {
+      pool.deallocate(*it);
+    }
+    pool.deallocate(0);
+    for (int i = 0; i < 500; ++i) {
+      EXPECT_EQ(1u, blocks.count(pool.allocate()));
+    }
+    EXPECT_EQ(num_chunks, upstream.d_num_allocations);
+
+    pool.reserve(100);
+    EXPECT_EQ(num_chunks + 1, upstream.d_num_allocations);
+    for (int i = 0; i < 100; ++i) {
+      pool.allocate();
+    }
+    EXPECT_EQ(num_chunks + 1, upstream.d_num_allocations);
+  }
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+}
+
+struct ThreadArgs {
+  ConcurrentPool* d_pool_p;
+  int d_id;
+  bool d_corrupted;
+};
+
+// Repeatedly pop a handful of blocks, stamp them with the thread id, check
+// nobody else handed out the same block meanwhile, and push them back.  Any
+// ABA corruption of the free list shows up as a block owned twice.
+void* worker(void* arg) {
+  ThreadArgs* args = static_cast<ThreadArgs*>(arg);
+  ConcurrentPool& pool = *args->d_pool_p;
+
+  int* blocks[8];
+  for (int round = 0; round < 20000; ++round) {
+    const int count = 1 + round % 8;
+    for (int i = 0; i < count; ++i) {
+      blocks[i] = static_cast<int*>(pool.allocate());
+      blocks[i][2] = args->d_id;
+    }
+    for (int i = 0; i < count; ++i) {
+      if (blocks[i][2] != args->d_id) {
+        args->d_corrupted = true;
+      }
+    }
+    for (int i = count; i-- > 0;) {
+      pool.deallocate(blocks[i]);
+    }
+  }
+  return 0;
+}
+
+TEST(ConcurrentPoolTest, Concurrent) {
+  my_CountingAllocator upstream;
+  {
+    ConcurrentPool pool(16, 4, &upstream);
+
+    const int k_num_threads = 8;
+    pthread_t threads[k_num_threads];
+    ThreadArgs args[k_num_threads];
+    for (int i = 0; i < k_num_threads; ++i) {
+      args[i].d_pool_p = &pool;
+      args[i].d_id = i;
+      args[i].d_corrupted = false;
+      ASSERT_EQ(0, pthread_create(&threads[i], 0, &worker, &args[i]));
+    }
+    for (int i = 0; i < k_num_threads; ++i) {
+      ASSERT_EQ(0, pthread_join(threads[i], 0));
+      EXPECT_FALSE(args[i].d_corrupted);
+    }
+
+    // Every block made it back onto the free list exactly once.
+    std::set<void*> blocks;
+    const int k_max_live = k_num_threads * 8;
+    for (int i = 0; i < k_max_live; ++i) {
+      EXPECT_TRUE(blocks.insert(pool.allocate()).second);
+    }
+  }
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+}
+
+}  // namespace
+}  // namespace llcl
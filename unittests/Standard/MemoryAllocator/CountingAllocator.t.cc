@@ -0,0 +1,109 @@
+#include "llcl/Standard/MemoryAllocator/CountingAllocator.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::CountingAllocator;
+using llcl::standard::ma::TaggedAllocator;
+
+TEST(CountingAllocatorTest, BucketIndex) {
+  EXPECT_EQ(0, CountingAllocator::bucketIndex(1));
+  EXPECT_EQ(1, CountingAllocator::bucketIndex(2));
+  EXPECT_EQ(2, CountingAllocator::bucketIndex(3));
+  EXPECT_EQ(2, CountingAllocator::bucketIndex(4));
+  EXPECT_EQ(3, CountingAllocator::bucketIndex(5));
+  EXPECT_EQ(10, CountingAllocator::bucketIndex(1024));
+  EXPECT_EQ(11, CountingAllocator::bucketIndex(1025));
+  EXPECT_EQ(CountingAllocator::NUM_SIZE_BUCKETS - 1,
+            CountingAllocator::bucketIndex(1ull << 40));
+}
+
+TEST(CountingAllocatorTest, Counters) {
+  CountingAllocator allocator("test");
+  EXPECT_STREQ("test", allocator.name());
+  EXPECT_EQ(0, allocator.allocate(0));
+
+  void* a = allocator.allocate(100);
+  void* b = allocator.allocate(28);
+  void* c = allocator.allocate(100);
+  EXPECT_EQ(0u, reinterpret_cast<std::size_t>(a) %
+                    CountingAllocator::MAX_ALIGNMENT);
+
+  EXPECT_EQ(3, allocator.numAllocations());
+  EXPECT_EQ(3, allocator.blocksInUse());
+  EXPECT_EQ(228, allocator.bytesInUse());
+  EXPECT_EQ(228, allocator.peakBytesInUse());
+  EXPECT_EQ(2, allocator.numAllocationsInBucket(7));
+  EXPECT_EQ(1, allocator.numAllocationsInBucket(5));
+
+  allocator.deallocate(a);
+  allocator.deallocate(0);
+  EXPECT_EQ(1, allocator.numDeallocations());
+  EXPECT_EQ(128, allocator.bytesInUse());
+  EXPECT_EQ(228, allocator.peakBytesInUse());
+
+  allocator.resetPeak();
+  EXPECT_EQ(128, allocator.peakBytesInUse());
+
+  allocator.deallocate(b);
+  allocator.deallocate(c);
+  EXPECT_EQ(0, allocator.bytesInUse());
+  EXPECT_EQ(0, allocator.blocksInUse());
+  EXPECT_EQ(228, allocator.bytesAllocated());
+}
+
+TEST(CountingAllocatorTest, Tags) {
+  CountingAllocator allocator;
+  CountingAllocator::Tag tag("call site");
+  TaggedAllocator tagged(&allocator, &tag);
+  EXPECT_STREQ("call site", tag.name());
+
+  void* a = tagged.allocate(64);
+  void* b = allocator.allocate(32, &tag);
+  void* c = allocator.allocate(16);
+
+  EXPECT_EQ(2, tag.numAllocations());
+  EXPECT_EQ(96, tag.bytesInUse());
+  EXPECT_EQ(112, allocator.bytesInUse());
+
+  // Blocks can be returned through either allocator.
+  allocator.deallocate(a);
+  tagged.deallocate(b);
+  allocator.deallocate(c);
+  EXPECT_EQ(0, tag.bytesInUse());
+  EXPECT_EQ(96, tag.bytesAllocated());
+  EXPECT_EQ(0, allocator.bytesInUse());
+}
+
+void* worker(void* arg) {
+  CountingAllocator* allocator = static_cast<CountingAllocator*>(arg);
+  for (int i = 0; i < 1000; ++i) {
+    void* block = allocator->allocate(1 + i % 200);
+    allocator->deallocate(block);
+  }
+  return 0;
+}
+
+TEST(CountingAllocatorTest, Concurrent) {
+  CountingAllocator allocator;
+
+  const int k_num_threads = 4;
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &worker, &allocator));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(4000, allocator.numAllocations());
+  EXPECT_EQ(4000, allocator.numDeallocations());
+  EXPECT_EQ(0, allocator.bytesInUse());
+  EXPECT_LE(200, allocator.peakBytesInUse());
+}
+
+}  // namespace
+}  // namespace llcl
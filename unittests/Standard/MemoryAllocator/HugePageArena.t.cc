@@ -0,0 +1,79 @@
+#include "llcl/Standard/MemoryAllocator/HugePageArena.h"
+
+#include <gtest/gtest.h>
+
+#ifdef LLCL_PLATFORM_OS_UNIX
+
+#include <cstring>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::HugePageArena;
+
+HugePageArena::size_type totalMapped(const HugePageArena& arena) {
+  HugePageArena::size_type total = 0;
+  for (int i = 0; i < HugePageArena::NUM_PAGE_KINDS; ++i) {
+    total += arena.bytesMapped(static_cast<HugePageArena::PageKind>(i));
+  }
+  return total;
+}
+
+TEST(HugePageArenaTest, Allocate) {
+  HugePageArena arena(1);
+  EXPECT_EQ(HugePageArena::size_type(HugePageArena::HUGE_PAGE_SIZE),
+            arena.chunkSize());
+  EXPECT_EQ(0u, totalMapped(arena));
+  EXPECT_EQ(0, arena.allocate(0));
+
+  char* first = static_cast<char*>(arena.allocate(1));
+  EXPECT_EQ(arena.chunkSize(), totalMapped(arena));
+
+  void* aligned = arena.allocate(16);
+  EXPECT_EQ(0u, reinterpret_cast<std::size_t>(aligned) % 16);
+
+  // Fill the rest of the chunk; everything stays in the first mapping.
+  const HugePageArena::size_type block_size = 4096;
+  for (int i = 0; i < 500; ++i) {
+    char* block = static_cast<char*>(arena.allocate(block_size));
+    memset(block, i, block_size);
+    EXPECT_LT(first, block);
+    EXPECT_LE(block + block_size, first + arena.chunkSize());
+  }
+  EXPECT_EQ(arena.chunkSize(), totalMapped(arena));
+
+  // Oversized requests get a chunk of their own.
+  char* big = static_cast<char*>(arena.allocate(3 * arena.chunkSize()));
+  big[3 * arena.chunkSize() - 1] = 1;
+  EXPECT_EQ(5 * arena.chunkSize(), totalMapped(arena));
+
+  arena.release();
+  EXPECT_EQ(0u, totalMapped(arena));
+  EXPECT_NE(static_cast<void*>(0), arena.allocate(1));
+}
+
+TEST(HugePageArenaTest, ReservePrefaultAndLock) {
+  HugePageArena arena(HugePageArena::HUGE_PAGE_SIZE,
+                      HugePageArena::PREFAULT | HugePageArena::LOCK);
+
+  arena.reserve(3 * HugePageArena::HUGE_PAGE_SIZE);
+  const HugePageArena::size_type mapped = totalMapped(arena);
+  EXPECT_LE(3u * HugePageArena::HUGE_PAGE_SIZE, mapped);
+
+  // Locking may be refused by 'RLIMIT_MEMLOCK', but is all or nothing.
+  EXPECT_TRUE(0 == arena.bytesLocked() || mapped == arena.bytesLocked());
+
+  for (int i = 0; i < 3; ++i) {
+    arena.allocate(HugePageArena::HUGE_PAGE_SIZE - 64);
+  }
+  EXPECT_EQ(mapped, totalMapped(arena));
+
+  // A reservation already covered by the current chunk maps nothing.
+  arena.reserve(32);
+  EXPECT_EQ(mapped, totalMapped(arena));
+}
+
+}  // namespace
+}  // namespace llcl
+
+#endif  // LLCL_PLATFORM_OS_UNIX
@@ -0,0 +1,117 @@
+#include "llcl/Standard/MemoryAllocator/Multipool.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::Multipool;
+using llcl::standard::Types;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+TEST(MultipoolTest, SizeClasses) {
+  Multipool multipool;
+
+  EXPECT_EQ(Multipool::DEFAULT_NUM_POOLS, multipool.numPools());
+  EXPECT_EQ(512u, multipool.maxPooledBlockSize());
+  EXPECT_EQ(8u, multipool.poolBlockSize(0));
+  EXPECT_EQ(16u, multipool.poolBlockSize(1));
+  EXPECT_EQ(512u, multipool.poolBlockSize(6));
+
+  const Types::size_type sizes[] = {1, 8, 9, 16, 17, 100, 256, 257, 512, 513};
+  const int classes[] = {0, 0, 1, 1, 2, 4, 5, 6, 6, 7};
+  for (int i = 0; i < 10; ++i) {
+    const Types::Uint64 before = multipool.numAllocations(classes[i]);
+    void* address = multipool.allocate(sizes[i]);
+    EXPECT_EQ(before + 1, multipool.numAllocations(classes[i])) << sizes[i];
+    multipool.deallocate(address);
+    EXPECT_EQ(0u, multipool.numBlocksInUse(classes[i])) << sizes[i];
+  }
+  EXPECT_EQ(2u, multipool.numAllocations(0));
+  EXPECT_EQ(2u, multipool.numAllocations(1));
+  EXPECT_EQ(1u, multipool.numAllocations(multipool.numPools()));
+}
+
+TEST(MultipoolTest, Alignment) {
+  Multipool multipool;
+
+  for (Types::size_type size = 1; size <= 1024; ++size) {
+    void* address = multipool.allocate(size);
+    const Types::UintPtr value = reinterpret_cast<Types::UintPtr>(address);
+    EXPECT_EQ(0u, value % (size < 16 ? 8 : 16)) << size;
+    multipool.deallocate(address);
+  }
+}
+
+TEST(MultipoolTest, ReuseAndStatistics) {
+  my_CountingAllocator upstream;
+  {
+    Multipool multipool(4, 16, &upstream);
+    EXPECT_EQ(64u, multipool.maxPooledBlockSize());
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 100; ++i) {
+      blocks.push_back(multipool.allocate(24));
+    }
+    void* big = multipool.allocate(1000);
+    EXPECT_EQ(100u, multipool.numBlocksInUse(2));
+    EXPECT_EQ(1u, multipool.numBlocksInUse(4));
+
+    for (int i = 0; i < 50; ++i) {
+      multipool.deallocate(blocks[i]);
+    }
+    multipool.deallocate(big);
+    EXPECT_EQ(50u, multipool.numBlocksInUse(2));
+    EXPECT_EQ(100u, multipool.peakBlocksInUse(2));
+    EXPECT_EQ(0u, multipool.numBlocksInUse(4));
+
+    const int num_upstream = upstream.d_num_allocations;
+    for (int i = 0; i < 50; ++i) {
+      multipool.allocate(32);
+    }
+    EXPECT_EQ(num_upstream, upstream.d_num_allocations);
+    EXPECT_EQ(150u, multipool.numAllocations(2));
+
+    multipool.reserve(8, 100);
+    const int after_reserve = upstream.d_num_allocations;
+    for (int i = 0; i < 100; ++i) {
+      multipool.allocate(8);
+    }
+    EXPECT_EQ(after_reserve, upstream.d_num_allocations);
+
+    multipool.release();
+    EXPECT_EQ(0u, multipool.numBlocksInUse(2));
+    EXPECT_EQ(150u, multipool.numAllocations(2));
+  }
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+}
+
+TEST(MultipoolTest, DeleteObject) {
+  Multipool multipool;
+
+  std::vector<int>* object = new (multipool) std::vector<int>(10, 1);
+  EXPECT_EQ(1u, multipool.numBlocksInUse(2));
+  multipool.deleteObject(object);
+  EXPECT_EQ(0u, multipool.numBlocksInUse(2));
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,63 @@
+#include "llcl/Standard/MemoryAllocator/NodePool.h"
+
+#include <gtest/gtest.h>
+
+#include "llcl/Standard/ADT/ilist_base.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::NodePool;
+
+typedef ilist_base<false, void> list_base_type;
+typedef list_base_type::node_base_type node_base_type;
+
+int g_live_nodes = 0;
+
+struct my_Node : node_base_type {
+  int d_value;
+
+  explicit my_Node(int value) : d_value(value) { ++g_live_nodes; }
+
+  ~my_Node() { --g_live_nodes; }
+};
+
+TEST(NodePoolTest, IntrusiveList) {
+  NodePool<my_Node> pool;
+  pool.reserve(64);
+
+  node_base_type sentinel;
+  sentinel.setPrev(&sentinel);
+  sentinel.setNext(&sentinel);
+
+  for (int i = 0; i < 64; ++i) {
+    my_Node* node = pool.createNode(i);
+    list_base_type::insertBefore<node_base_type>(sentinel, *node);
+  }
+  EXPECT_EQ(64, g_live_nodes);
+
+  // Reserved nodes are laid out one after the other.
+  my_Node* prev = static_cast<my_Node*>(sentinel.getNext());
+  int expected = 0;
+  for (node_base_type* n = sentinel.getNext(); n != &sentinel;
+       n = n->getNext()) {
+    my_Node* node = static_cast<my_Node*>(n);
+    EXPECT_EQ(expected++, node->d_value);
+    if (node != prev) {
+      EXPECT_EQ(prev + 1, node);
+    }
+    prev = node;
+  }
+
+  while (sentinel.getNext() != &sentinel) {
+    node_base_type* n = sentinel.getNext();
+    list_base_type::remove(*n);
+    pool.deleteNode(static_cast<my_Node*>(n));
+  }
+  EXPECT_EQ(0, g_live_nodes);
+
+  pool.deleteNode(0);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,112 @@
+#include "llcl/Standard/MemoryAllocator/Pool.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::Pool;
+using llcl::standard::Types;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+  size_type d_last_size = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    d_last_size = size;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+TEST(PoolTest, BlockSize) {
+  EXPECT_EQ(sizeof(void*), Pool(1).blockSize());
+  EXPECT_EQ(sizeof(void*), Pool(sizeof(void*)).blockSize());
+  EXPECT_EQ(2 * sizeof(void*), Pool(sizeof(void*) + 1).blockSize());
+  EXPECT_EQ(24u, Pool(24).blockSize());
+}
+
+TEST(PoolTest, AllocateDeallocate) {
+  my_CountingAllocator upstream;
+  {
+    Pool pool(24, &upstream);
+
+    std::set<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+      void* block = pool.allocate();
+      EXPECT_EQ(0u, reinterpret_cast<Types::UintPtr>(block) % 8);
+      EXPECT_TRUE(blocks.insert(block).second);
+    }
+    const int num_chunks = upstream.d_num_allocations;
+    EXPECT_GT(20, num_chunks);
+
+    // Freed blocks are reused without going back upstream.
+    for (std::set<void*>::iterator it = blocks.begin(); it != blocks.end();
+         ++it) {
+      pool.deallocate(*it);
+    }
+    pool.deallocate(0);
+    for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(1u, blocks.count(pool.allocate()));
+    }
+    EXPECT_EQ(num_chunks, upstream.d_num_allocations);
+    EXPECT_EQ(0, upstream.d_num_deallocations);
+  }
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+}
+
+TEST(PoolTest, ConsecutiveBlocksAreContiguous) {
+  Pool pool(32, 8, 0);
+  pool.reserve(8);
+
+  char* first = static_cast<char*>(pool.allocate());
+  for (int i = 1; i < 8; ++i) {
+    EXPECT_EQ(first + i * 32, pool.allocate());
+  }
+}
+
+TEST(PoolTest, Reserve) {
+  my_CountingAllocator upstream;
+  Pool pool(16, 4, &upstream);
+
+  pool.reserve(100);
+  EXPECT_EQ(1, upstream.d_num_allocations);
+  for (int i = 0; i < 100; ++i) {
+    pool.allocate();
+  }
+  EXPECT_EQ(1, upstream.d_num_allocations);
+
+  // Reserving less than what is already free does nothing.
+  void* block = pool.allocate();
+  EXPECT_EQ(2, upstream.d_num_allocations);
+  pool.deallocate(block);
+  pool.reserve(1);
+  EXPECT_EQ(2, upstream.d_num_allocations);
+}
+
+TEST(PoolTest, Release) {
+  my_CountingAllocator upstream;
+  Pool pool(16, &upstream);
+
+  for (int i = 0; i < 100; ++i) {
+    pool.allocate();
+  }
+  pool.release();
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+
+  pool.allocate();
+  EXPECT_EQ(upstream.d_num_deallocations + 1, upstream.d_num_allocations);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,152 @@
+#include "llcl/Standard/MemoryAllocator/SequentialAllocator.h"
+
+#include <gtest/gtest.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::SequentialAllocator;
+using llcl::standard::Types;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+  size_type d_last_size = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    d_last_size = size;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+bool isAligned(const void* address, Types::size_type alignment) {
+  return 0 == reinterpret_cast<Types::UintPtr>(address) % alignment;
+}
+
+TEST(SequentialAllocatorTest, NaturalAlignment) {
+  my_CountingAllocator upstream;
+  SequentialAllocator allocator(&upstream);
+
+  EXPECT_EQ(nullptr, allocator.allocate(0));
+  EXPECT_EQ(0, upstream.d_num_allocations);
+
+  void* a = allocator.allocate(1);
+  void* b = allocator.allocate(8);
+  void* c = allocator.allocate(2);
+  void* d = allocator.allocate(4);
+  void* e = allocator.allocate(3);
+  void* f = allocator.allocate(64);
+
+  EXPECT_TRUE(isAligned(a, 1));
+  EXPECT_TRUE(isAligned(b, 8));
+  EXPECT_TRUE(isAligned(c, 2));
+  EXPECT_TRUE(isAligned(d, 4));
+  EXPECT_TRUE(isAligned(e, 1));
+  EXPECT_TRUE(isAligned(f, Allocator::MAX_ALIGNMENT));
+
+  // Consecutive requests are packed into the same chunk.
+  EXPECT_EQ(1, upstream.d_num_allocations);
+  EXPECT_EQ(static_cast<char*>(a) + 8, static_cast<char*>(b));
+}
+
+TEST(SequentialAllocatorTest, GeometricGrowth) {
+  my_CountingAllocator upstream;
+  SequentialAllocator allocator(64, 1024, &upstream);
+
+  for (int i = 0; i < 4; ++i) {
+    allocator.allocate(16);
+  }
+  EXPECT_EQ(1, upstream.d_num_allocations);
+
+  allocator.allocate(16);
+  EXPECT_EQ(2, upstream.d_num_allocations);
+  const Types::size_type header_size = upstream.d_last_size - 128;
+
+  for (int i = 0; i < 8; ++i) {
+    allocator.allocate(16);
+  }
+  EXPECT_EQ(3, upstream.d_num_allocations);
+  EXPECT_EQ(header_size + 256, upstream.d_last_size);
+
+  // Growth stops at the maximum block size.
+  for (int i = 0; i < 1000; ++i) {
+    allocator.allocate(16);
+  }
+  EXPECT_EQ(header_size + 1024, upstream.d_last_size);
+  EXPECT_EQ(0, upstream.d_num_deallocations);
+}
+
+TEST(SequentialAllocatorTest, OversizedRequest) {
+  my_CountingAllocator upstream;
+  SequentialAllocator allocator(64, 256, &upstream);
+
+  allocator.allocate(16);
+  EXPECT_EQ(1, upstream.d_num_allocations);
+  const Types::size_type remaining = allocator.remainingInCurrentBlock();
+
+  void* big = allocator.allocate(1000);
+  EXPECT_NE(nullptr, big);
+  EXPECT_TRUE(isAligned(big, Allocator::MAX_ALIGNMENT));
+  EXPECT_EQ(2, upstream.d_num_allocations);
+  EXPECT_EQ(remaining, allocator.remainingInCurrentBlock());
+}
+
+TEST(SequentialAllocatorTest, DeallocateAndRelease) {
+  my_CountingAllocator upstream;
+  {
+    SequentialAllocator allocator(&upstream);
+
+    for (int i = 0; i < 10000; ++i) {
+      void* address = allocator.allocate(24);
+      allocator.deallocate(address);
+    }
+    const int num_blocks = upstream.d_num_allocations;
+    EXPECT_LT(1, num_blocks);
+    EXPECT_GT(20, num_blocks);
+    EXPECT_EQ(0, upstream.d_num_deallocations);
+
+    allocator.release();
+    EXPECT_EQ(num_blocks, upstream.d_num_deallocations);
+    EXPECT_EQ(0u, allocator.remainingInCurrentBlock());
+
+    allocator.allocate(24);
+    EXPECT_EQ(num_blocks + 1, upstream.d_num_allocations);
+  }
+  EXPECT_EQ(upstream.d_num_allocations, upstream.d_num_deallocations);
+}
+
+TEST(SequentialAllocatorTest, InitialBuffer) {
+  my_CountingAllocator upstream;
+  alignas(Allocator::MAX_ALIGNMENT) char buffer[128];
+  {
+    SequentialAllocator allocator(buffer, sizeof buffer, &upstream);
+
+    for (int i = 0; i < 8; ++i) {
+      char* address = static_cast<char*>(allocator.allocate(16));
+      EXPECT_LE(buffer, address);
+      EXPECT_GT(buffer + sizeof buffer, address);
+    }
+    EXPECT_EQ(0, upstream.d_num_allocations);
+
+    char* address = static_cast<char*>(allocator.allocate(16));
+    EXPECT_TRUE(address < buffer || buffer + sizeof buffer <= address);
+    EXPECT_EQ(1, upstream.d_num_allocations);
+
+    // After 'release' the buffer is reused.
+    allocator.release();
+    EXPECT_EQ(1, upstream.d_num_deallocations);
+    EXPECT_EQ(buffer, allocator.allocate(16));
+  }
+  EXPECT_EQ(1, upstream.d_num_deallocations);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,148 @@
+#include "llcl/Standard/MemoryAllocator/ThreadCachingAllocator.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include <vector>
+
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::ThreadCachingAllocator;
+using llcl::standard::Types;
+
+// Not thread-safe on purpose: 'ThreadCachingAllocator' must serialize all
+// calls into its backing allocator.
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    return ::operator new(size);
+  }
+
+  void deallocate(void* address) override {
+    ++d_num_deallocations;
+    ::operator delete(address);
+  }
+};
+
+TEST(ThreadCachingAllocatorTest, CachedPath) {
+  my_CountingAllocator backing;
+  {
+    ThreadCachingAllocator allocator(&backing);
+    EXPECT_EQ(nullptr, allocator.allocate(0));
+
+    void* first = allocator.allocate(24);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(0u, reinterpret_cast<Types::UintPtr>(first) % 16);
+
+    // Thread cache plus one batch.
+    const int after_refill = backing.d_num_allocations;
+    EXPECT_EQ(1 + ThreadCachingAllocator::BATCH_SIZE, after_refill);
+
+    // Freed blocks are reused from the cache.
+    allocator.deallocate(first);
+    std::vector<void*> blocks;
+    blocks.push_back(allocator.allocate(32));
+    EXPECT_EQ(first, blocks.back());
+    for (int i = 1; i < ThreadCachingAllocator::BATCH_SIZE; ++i) {
+      blocks.push_back(allocator.allocate(17));
+    }
+    EXPECT_EQ(after_refill, backing.d_num_allocations);
+    EXPECT_EQ(0, backing.d_num_deallocations);
+
+    // A different size class has its own magazine.
+    blocks.push_back(allocator.allocate(8));
+    EXPECT_EQ(after_refill + ThreadCachingAllocator::BATCH_SIZE,
+              backing.d_num_allocations);
+
+    // Oversized requests go straight to the backing allocator.
+    void* big =
+        allocator.allocate(ThreadCachingAllocator::MAX_CACHED_SIZE + 1);
+    EXPECT_EQ(after_refill + ThreadCachingAllocator::BATCH_SIZE + 1,
+              backing.d_num_allocations);
+    allocator.deallocate(big);
+    EXPECT_EQ(1, backing.d_num_deallocations);
+
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+      allocator.deallocate(blocks[i]);
+    }
+  }
+  EXPECT_EQ(backing.d_num_allocations, backing.d_num_deallocations);
+}
+
+TEST(ThreadCachingAllocatorTest, FlushWhenFull) {
+  my_CountingAllocator backing;
+  ThreadCachingAllocator allocator(&backing);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < ThreadCachingAllocator::MAGAZINE_CAPACITY + 1; ++i) {
+    blocks.push_back(allocator.allocate(64));
+  }
+  const int num_allocations = backing.d_num_allocations;
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    allocator.deallocate(blocks[i]);
+  }
+  EXPECT_EQ(ThreadCachingAllocator::BATCH_SIZE, backing.d_num_deallocations);
+
+  allocator.flushThreadCache();
+  EXPECT_EQ(num_allocations - 1, backing.d_num_deallocations);
+}
+
+struct ThreadArgs {
+  ThreadCachingAllocator* d_allocator_p;
+  standard::AtomicPointer<char> d_handoff[16];
+};
+
+void* worker(void* arg) {
+  ThreadArgs* args = static_cast<ThreadArgs*>(arg);
+  ThreadCachingAllocator& allocator = *args->d_allocator_p;
+
+  void* blocks[100];
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < 100; ++i) {
+      blocks[i] = allocator.allocate(8 + (i * 37) % 600);
+      *static_cast<char*>(blocks[i]) = static_cast<char>(i);
+    }
+    // Free some of another thread's blocks and hand over one of ours.
+    for (int i = 0; i < 16; ++i) {
+      char* block = static_cast<char*>(blocks[i]);
+      allocator.deallocate(args->d_handoff[i].swapAcqRel(block));
+    }
+    for (int i = 16; i < 100; ++i) {
+      allocator.deallocate(blocks[i]);
+    }
+  }
+  return 0;
+}
+
+TEST(ThreadCachingAllocatorTest, Concurrent) {
+  my_CountingAllocator backing;
+  {
+    ThreadCachingAllocator allocator(&backing);
+    ThreadArgs args;
+    args.d_allocator_p = &allocator;
+
+    const int k_num_threads = 4;
+    pthread_t threads[k_num_threads];
+    for (int i = 0; i < k_num_threads; ++i) {
+      ASSERT_EQ(0, pthread_create(&threads[i], 0, &worker, &args));
+    }
+    for (int i = 0; i < k_num_threads; ++i) {
+      ASSERT_EQ(0, pthread_join(threads[i], 0));
+    }
+    for (int i = 0; i < 16; ++i) {
+      allocator.deallocate(args.d_handoff[i].load());
+    }
+  }
+  EXPECT_EQ(backing.d_num_allocations, backing.d_num_deallocations);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,105 @@
+#include "llcl/Standard/MultiThread/AdaptiveMutex.h"
+
+#include <gtest/gtest.h>
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::AdaptiveMutex;
+
+TEST(AdaptiveMutexTest, Basic) {
+  AdaptiveMutex mutex;
+  EXPECT_EQ(AdaptiveMutex::DEFAULT_MAX_SPINS, mutex.maxSpins());
+  EXPECT_EQ(0, mutex.spinBudget());
+
+  EXPECT_EQ(0, mutex.try_lock());
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock();
+
+  mutex.lock();
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock();
+
+  mutex.setMaxSpins(5);
+  EXPECT_EQ(5, mutex.maxSpins());
+}
+
+struct SharedCounter {
+  AdaptiveMutex* d_lock_p;
+  long d_value;
+};
+
+const int k_num_iterations = 100000;
+
+void* increment(void* arg) {
+  SharedCounter* counter = static_cast<SharedCounter*>(arg);
+  for (int i = 0; i < k_num_iterations; ++i) {
+    counter->d_lock_p->lock();
+    const long value = counter->d_value;
+    if (0 == i % 1000) {
+      sched_yield();  // get preempted while holding the lock
+    }
+    counter->d_value = value + 1;
+    counter->d_lock_p->unlock();
+  }
+  return 0;
+}
+
+void runContention(AdaptiveMutex* mutex) {
+  SharedCounter counter;
+  counter.d_lock_p = mutex;
+  counter.d_value = 0;
+
+  const int k_num_threads = 4;
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &increment, &counter));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(k_num_threads * k_num_iterations, counter.d_value);
+  EXPECT_LE(0, mutex->spinBudget());
+  EXPECT_GE(mutex->maxSpins(), mutex->spinBudget());
+}
+
+TEST(AdaptiveMutexTest, Contention) {
+  AdaptiveMutex mutex;
+  runContention(&mutex);
+}
+
+TEST(AdaptiveMutexTest, ContentionWithoutSpinning) {
+  AdaptiveMutex mutex(0);
+  runContention(&mutex);
+  EXPECT_EQ(0, mutex.spinBudget());
+}
+
+TEST(AdaptiveMutexTest, NextSpinBudget) {
+  // Small differences still move the budget.
+  EXPECT_EQ(1, AdaptiveMutex::nextSpinBudget(0, 1));
+  EXPECT_EQ(4, AdaptiveMutex::nextSpinBudget(5, 4));
+  EXPECT_EQ(7, AdaptiveMutex::nextSpinBudget(7, 7));
+  EXPECT_EQ(12, AdaptiveMutex::nextSpinBudget(0, 90));
+
+  // Once contention stops, parking decays the budget all the way to zero.
+  int budget = AdaptiveMutex::DEFAULT_MAX_SPINS;
+  int steps = 0;
+  while (0 != budget) {
+    const int next = AdaptiveMutex::nextSpinBudget(budget, 0);
+    ASSERT_LT(next, budget);
+    budget = next;
+    ++steps;
+  }
+  EXPECT_GT(AdaptiveMutex::DEFAULT_MAX_SPINS, steps);
+}
+
+}  // namespace
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
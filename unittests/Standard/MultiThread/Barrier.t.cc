@@ -0,0 +1,83 @@
+#include "llcl/Standard/MultiThread/Barrier.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Barrier;
+
+TEST(BarrierTest, SingleThread) {
+  Barrier barrier(1);
+  EXPECT_EQ(1, barrier.numThreads());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(barrier.wait());
+  }
+}
+
+const int k_num_threads = 6;
+const int k_num_rounds = 500;
+
+struct my_Shared {
+  Barrier* d_barrier_p;
+  int d_slots[k_num_threads];
+  AtomicInt d_num_serial;
+  AtomicInt d_num_errors;
+};
+
+struct my_Args {
+  my_Shared* d_shared_p;
+  int d_index;
+};
+
+void* my_run(void* arg) {
+  my_Args* args = static_cast<my_Args*>(arg);
+  my_Shared* shared = args->d_shared_p;
+  for (int round = 1; round <= k_num_rounds; ++round) {
+    shared->d_slots[args->d_index] = round;
+    if (shared->d_barrier_p->wait()) {
+      ++shared->d_num_serial;
+    }
+
+    // Every thread has written this round's value, and nobody can write
+    // the next one before all threads have read it.
+    for (int i = 0; i < k_num_threads; ++i) {
+      if (round != shared->d_slots[i]) {
+        ++shared->d_num_errors;
+      }
+    }
+    if (shared->d_barrier_p->wait()) {
+      ++shared->d_num_serial;
+    }
+  }
+  return 0;
+}
+
+TEST(BarrierTest, PhasesAreSeparated) {
+  Barrier barrier(k_num_threads);
+
+  my_Shared shared;
+  shared.d_barrier_p = &barrier;
+  for (int i = 0; i < k_num_threads; ++i) {
+    shared.d_slots[i] = 0;
+  }
+
+  pthread_t threads[k_num_threads];
+  my_Args args[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    args[i].d_shared_p = &shared;
+    args[i].d_index = i;
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_run, &args[i]));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(0, shared.d_num_errors.load());
+  EXPECT_EQ(2 * k_num_rounds, shared.d_num_serial.load());
+}
+
+}  // namespace
+}  // namespace llcl
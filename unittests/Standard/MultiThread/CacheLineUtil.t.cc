@@ -0,0 +1,52 @@
+#include "llcl/Standard/MultiThread/CacheLineUtil.h"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::Types;
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::NewDeleteAllocator;
+using llcl::standard::mt::CacheLineUtil;
+using llcl::standard::mt::Platform;
+
+class my_CountingAllocator : public Allocator {
+ public:
+  int d_num_allocations = 0;
+  int d_num_deallocations = 0;
+  void* d_last_allocation_p = 0;
+
+  void* allocate(size_type size) override {
+    ++d_num_allocations;
+    d_last_allocation_p = NewDeleteAllocator::singleton().allocate(size);
+    return d_last_allocation_p;
+  }
+
+  void deallocate(void* address) override {
+    EXPECT_EQ(d_last_allocation_p, address);
+    ++d_num_deallocations;
+    NewDeleteAllocator::singleton().deallocate(address);
+  }
+};
+
+TEST(CacheLineUtilTest, AlignsAndReturnsOriginalBlock) {
+  my_CountingAllocator allocator;
+  for (int size = 1; size <= 3 * Platform::CACHE_LINE_SIZE; size += 7) {
+    void* block = CacheLineUtil::allocate(&allocator, size);
+    EXPECT_EQ(0u, reinterpret_cast<Types::UintPtr>(block) %
+                      Platform::CACHE_LINE_SIZE);
+    memset(block, 0xA5, size);
+    CacheLineUtil::deallocate(&allocator, block);
+  }
+  EXPECT_EQ(allocator.d_num_allocations, allocator.d_num_deallocations);
+
+  CacheLineUtil::deallocate(&allocator, 0);
+  EXPECT_EQ(allocator.d_num_allocations, allocator.d_num_deallocations);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,70 @@
+#include "llcl/Standard/MultiThread/ClhLock.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::ClhLock;
+
+TEST(ClhLockTest, Basic) {
+  ClhLock lock;
+  lock.lock();
+  lock.unlock();
+
+  lock.lock();
+  lock.unlock();
+}
+
+TEST(ClhLockTest, Nesting) {
+  ClhLock locks[ClhLock::MAX_NESTING];
+  for (int i = 0; i < ClhLock::MAX_NESTING; ++i) {
+    locks[i].lock();
+  }
+  for (int i = ClhLock::MAX_NESTING - 1; 0 <= i; --i) {
+    locks[i].unlock();
+  }
+}
+
+struct SharedCounter {
+  ClhLock* d_lock_p;
+  long d_value;
+};
+
+const int k_num_iterations = 20000;
+
+void* increment(void* arg) {
+  SharedCounter* counter = static_cast<SharedCounter*>(arg);
+  for (int i = 0; i < k_num_iterations; ++i) {
+    counter->d_lock_p->lock();
+    const long value = counter->d_value;
+    if (0 == i % 1000) {
+      sched_yield();  // get preempted while holding the lock
+    }
+    counter->d_value = value + 1;
+    counter->d_lock_p->unlock();
+  }
+  return 0;
+}
+
+TEST(ClhLockTest, Contention) {
+  ClhLock lock;
+  SharedCounter counter;
+  counter.d_lock_p = &lock;
+  counter.d_value = 0;
+
+  const int k_num_threads = 4;
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &increment, &counter));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(k_num_threads * k_num_iterations, counter.d_value);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,228 @@
+#include "llcl/Standard/MultiThread/Condition.h"
+
+#include <errno.h>
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::Condition;
+using llcl::standard::mt::ConditionImpl;
+using llcl::standard::mt::Mutex;
+using llcl::standard::mt::MutexImpl;
+using llcl::standard::mt::Platform;
+
+// Return the time of the specified 'clock' the specified 'millis' from now.
+timespec my_deadline(clockid_t clock, long millis) {
+  timespec deadline;
+  clock_gettime(clock, &deadline);
+  deadline.tv_sec += millis / 1000;
+  deadline.tv_nsec += (millis % 1000) * 1000000;
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_nsec -= 1000000000;
+    ++deadline.tv_sec;
+  }
+  return deadline;
+}
+
+bool my_reached(clockid_t clock, const timespec& deadline) {
+  timespec now;
+  clock_gettime(clock, &now);
+  return now.tv_sec > deadline.tv_sec ||
+         (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec);
+}
+
+template <class CONDITION, class MUTEX>
+struct my_Types {
+  typedef CONDITION ConditionType;
+  typedef MUTEX MutexType;
+};
+
+template <class TYPES>
+class ConditionTest : public ::testing::Test {};
+
+typedef ::testing::Types<
+    my_Types<Condition, Mutex>,
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+    my_Types<ConditionImpl<Platform::FutexThreads>,
+             MutexImpl<Platform::FutexThreads> >,
+#endif
+    my_Types<ConditionImpl<Platform::InstrumentedThreads>,
+             MutexImpl<Platform::InstrumentedThreads> >,
+    my_Types<ConditionImpl<Platform::PosixThreads>,
+             MutexImpl<Platform::PosixThreads> > >
+    my_ConditionTypes;
+TYPED_TEST_SUITE(ConditionTest, my_ConditionTypes);
+
+TYPED_TEST(ConditionTest, TimedWaitTimesOut) {
+  typedef typename TypeParam::ConditionType Obj;
+  typename TypeParam::MutexType mutex;
+
+  const clockid_t k_clocks[] = {CLOCK_MONOTONIC, CLOCK_REALTIME};
+  for (int i = 0; i < 2; ++i) {
+    Obj condition(k_clocks[i]);
+    EXPECT_EQ(k_clocks[i], condition.clockType());
+
+    // Signals without waiters are not remembered.
+    condition.signal();
+    condition.broadcast();
+
+    mutex.lock();
+    const timespec deadline = my_deadline(k_clocks[i], 20);
+    int status;
+    do {
+      status = condition.timedWait(&mutex, deadline);
+    } while (0 == status);
+    EXPECT_EQ(ETIMEDOUT, status);
+    EXPECT_TRUE(my_reached(k_clocks[i], deadline));
+
+    // The mutex is held again.
+    EXPECT_NE(0, mutex.try_lock());
+    mutex.unlock();
+  }
+}
+
+template <class TYPES>
+struct my_Shared {
+  typename TYPES::MutexType d_mutex;
+  typename TYPES::ConditionType d_condition;
+  int d_generation;
+  int d_num_waiting;
+  int d_num_woken;
+  long d_counter;
+};
+
+// Wait for the generation to change, then bump the counter under the lock.
+template <class TYPES>
+void* my_waitForGeneration(void* arg) {
+  my_Shared<TYPES>* shared = static_cast<my_Shared<TYPES>*>(arg);
+  shared->d_mutex.lock();
+  const int generation = shared->d_generation;
+  ++shared->d_num_waiting;
+  while (generation == shared->d_generation) {
+    shared->d_condition.wait(&shared->d_mutex);
+  }
+  ++shared->d_num_woken;
+  for (int i = 0; i < 1000; ++i) {
+    ++shared->d_counter;
+  }
+  shared->d_mutex.unlock();
+  return 0;
+}
+
+template <class TYPES>
+void my_wakeWaiters(bool broadcast) {
+  my_Shared<TYPES> shared;
+  shared.d_generation = 0;
+  shared.d_num_waiting = 0;
+  shared.d_num_woken = 0;
+  shared.d_counter = 0;
+
+  const int k_num_waiters = 8;
+  pthread_t threads[k_num_waiters];
+  for (int i = 0; i < k_num_waiters; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_waitForGeneration<TYPES>,
+                                &shared));
+  }
+
+  // Wait for every thread to be waiting.
+  for (;;) {
+    shared.d_mutex.lock();
+    const int num_waiting = shared.d_num_waiting;
+    shared.d_mutex.unlock();
+    if (k_num_waiters == num_waiting) {
+      break;
+    }
+    sched_yield();
+  }
+
+  shared.d_mutex.lock();
+  ++shared.d_generation;
+  if (broadcast) {
+    shared.d_condition.broadcast();
+  } else {
+    for (int i = 0; i < k_num_waiters; ++i) {
+      shared.d_condition.signal();
+    }
+  }
+  shared.d_mutex.unlock();
+
+  for (int i = 0; i < k_num_waiters; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(k_num_waiters, shared.d_num_woken);
+  EXPECT_EQ(k_num_waiters * 1000, shared.d_counter);
+}
+
+TYPED_TEST(ConditionTest, BroadcastWakesAllWaiters) {
+  my_wakeWaiters<TypeParam>(true);
+}
+
+TYPED_TEST(ConditionTest, SignalWakesWaiters) {
+  my_wakeWaiters<TypeParam>(false);
+}
+
+template <class TYPES>
+struct my_Queue {
+  typename TYPES::MutexType d_mutex;
+  typename TYPES::ConditionType d_not_empty;
+  int d_items;
+  int d_consumed;
+};
+
+const int k_num_items = 20000;
+
+template <class TYPES>
+void* my_consume(void* arg) {
+  my_Queue<TYPES>* queue = static_cast<my_Queue<TYPES>*>(arg);
+  for (int i = 0; i < k_num_items; ++i) {
+    queue->d_mutex.lock();
+    while (0 == queue->d_items) {
+      queue->d_not_empty.wait(&queue->d_mutex);
+    }
+    --queue->d_items;
+    ++queue->d_consumed;
+    queue->d_mutex.unlock();
+  }
+  return 0;
+}
+
+template <class TYPES>
+void* my_produce(void* arg) {
+  my_Queue<TYPES>* queue = static_cast<my_Queue<TYPES>*>(arg);
+  for (int i = 0; i < k_num_items; ++i) {
+    queue->d_mutex.lock();
+    ++queue->d_items;
+    if (0 == i % 3) {
+      queue->d_not_empty.broadcast();
+    } else {
+      queue->d_not_empty.signal();
+    }
+    queue->d_mutex.unlock();
+  }
+  return 0;
+}
+
+TYPED_TEST(ConditionTest, ProducersAndConsumers) {
+  my_Queue<TypeParam> queue;
+  queue.d_items = 0;
+  queue.d_consumed = 0;
+
+  const int k_num_pairs = 3;
+  pthread_t threads[2 * k_num_pairs];
+  for (int i = 0; i < k_num_pairs; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[2 * i], 0, &my_consume<TypeParam>,
+                                &queue));
+    ASSERT_EQ(0, pthread_create(&threads[2 * i + 1], 0,
+                                &my_produce<TypeParam>, &queue));
+  }
+  for (int i = 0; i < 2 * k_num_pairs; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(k_num_pairs * k_num_items, queue.d_consumed);
+  EXPECT_EQ(0, queue.d_items);
+}
+
+}  // namespace
+}  // namespace llcl
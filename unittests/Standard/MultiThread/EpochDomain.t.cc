@@ -0,0 +1,189 @@
+#include "llcl/Standard/MultiThread/EpochDomain.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::AtomicPointer;
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::NewDeleteAllocator;
+using llcl::standard::mt::EpochDomain;
+using llcl::standard::mt::EpochGuard;
+
+AtomicInt g_num_live;
+
+struct my_Node {
+  int d_value;
+  my_Node* d_next_p;
+
+  explicit my_Node(int value) : d_value(value), d_next_p(0) { ++g_num_live; }
+
+  ~my_Node() {
+    d_value = -1;
+    --g_num_live;
+  }
+};
+
+TEST(EpochDomainTest, ReclaimAfterReadersLeave) {
+  Allocator* allocator = &NewDeleteAllocator::singleton();
+  g_num_live = 0;
+  {
+    EpochDomain domain(allocator);
+
+    domain.retire(new (*allocator) my_Node(1));
+    EXPECT_EQ(1, g_num_live.load());
+
+    domain.reclaim();
+    EXPECT_EQ(0, g_num_live.load());
+
+    // Nested critical sections.
+    {
+      EpochGuard outer(&domain);
+      EpochGuard inner(&domain);
+      domain.retire(new (*allocator) my_Node(2));
+    }
+    domain.reclaim();
+    EXPECT_EQ(0, g_num_live.load());
+
+    domain.retire(new (*allocator) my_Node(3));
+  }
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+struct ReaderArgs {
+  EpochDomain* d_domain_p;
+  AtomicInt d_entered;
+  AtomicInt d_leave;
+};
+
+void* stalledReader(void* arg) {
+  ReaderArgs* args = static_cast<ReaderArgs*>(arg);
+  {
+    EpochGuard guard(args->d_domain_p);
+    args->d_entered = 1;
+    while (!args->d_leave.loadAcquire()) {
+      sched_yield();
+    }
+  }
+  return 0;
+}
+
+TEST(EpochDomainTest, ReaderBlocksReclamation) {
+  Allocator* allocator = &NewDeleteAllocator::singleton();
+  g_num_live = 0;
+
+  EpochDomain domain(allocator);
+  ReaderArgs args;
+  args.d_domain_p = &domain;
+
+  pthread_t reader;
+  ASSERT_EQ(0, pthread_create(&reader, 0, &stalledReader, &args));
+  while (!args.d_entered.loadAcquire()) {
+    sched_yield();
+  }
+
+  domain.retire(new (*allocator) my_Node(1));
+  domain.reclaim();
+  domain.reclaim();
+  EXPECT_EQ(1, g_num_live.load());
+
+  args.d_leave.storeRelease(1);
+  pthread_join(reader, 0);
+
+  domain.reclaim();
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+// A Treiber stack whose popped nodes are retired through the domain.
+class my_Stack {
+  AtomicPointer<my_Node> d_head;
+  EpochDomain* d_domain_p;
+  Allocator* d_allocator_p;
+
+ public:
+  my_Stack(EpochDomain* domain)
+      : d_domain_p(domain), d_allocator_p(domain->allocator()) {}
+
+  void push(int value) {
+    my_Node* node = new (*d_allocator_p) my_Node(value);
+    my_Node* head = d_head.loadAcquire();
+    for (;;) {
+      node->d_next_p = head;
+      my_Node* prev = d_head.testAndSwapAcqRel(head, node);
+      if (prev == head) {
+        return;
+      }
+      head = prev;
+    }
+  }
+
+  bool pop(int* value) {
+    EpochGuard guard(d_domain_p);
+
+    my_Node* head = d_head.loadAcquire();
+    while (head) {
+      my_Node* prev = d_head.testAndSwapAcqRel(head, head->d_next_p);
+      if (prev == head) {
+        *value = head->d_value;
+        d_domain_p->retire(head);
+        return true;
+      }
+      head = prev;
+    }
+    return false;
+  }
+};
+
+struct WorkerArgs {
+  my_Stack* d_stack_p;
+  int d_id;
+  bool d_ok;
+};
+
+void* worker(void* arg) {
+  WorkerArgs* args = static_cast<WorkerArgs*>(arg);
+  args->d_ok = true;
+  for (int i = 0; i < 20000; ++i) {
+    args->d_stack_p->push(args->d_id * 100000 + i);
+    int value;
+    if (!args->d_stack_p->pop(&value) || value < 0) {
+      args->d_ok = false;
+    }
+  }
+  return 0;
+}
+
+TEST(EpochDomainTest, ConcurrentStack) {
+  g_num_live = 0;
+  {
+    EpochDomain domain(&NewDeleteAllocator::singleton());
+    my_Stack stack(&domain);
+
+    const int k_num_threads = 4;
+    pthread_t threads[k_num_threads];
+    WorkerArgs args[k_num_threads];
+    for (int i = 0; i < k_num_threads; ++i) {
+      args[i].d_stack_p = &stack;
+      args[i].d_id = i;
+      ASSERT_EQ(0, pthread_create(&threads[i], 0, &worker, &args[i]));
+    }
+    for (int i = 0; i < k_num_threads; ++i) {
+      pthread_join(threads[i], 0);
+      EXPECT_TRUE(args[i].d_ok);
+    }
+
+    // Every reader has left, so everything retired can go.
+    domain.reclaim();
+    EXPECT_EQ(0, g_num_live.load());
+  }
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+}  // namespace
+}  // namespace llcl
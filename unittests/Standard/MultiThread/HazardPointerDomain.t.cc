@@ -0,0 +1,205 @@
+#include "llcl/Standard/MultiThread/HazardPointerDomain.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "llcl/Standard/MemoryAllocator/NewDeleteAllocator.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::AtomicPointer;
+using llcl::standard::ma::Allocator;
+using llcl::standard::ma::NewDeleteAllocator;
+using llcl::standard::mt::HazardPointerDomain;
+using llcl::standard::mt::HazardPointerGuard;
+
+AtomicInt g_num_live;
+
+struct my_Node {
+  int d_value;
+  my_Node* d_next_p;
+
+  explicit my_Node(int value) : d_value(value), d_next_p(0) { ++g_num_live; }
+
+  ~my_Node() {
+    d_value = -1;
+    --g_num_live;
+  }
+};
+
+TEST(HazardPointerDomainTest, ProtectedObjectSurvives) {
+  Allocator* allocator = &NewDeleteAllocator::singleton();
+  g_num_live = 0;
+  {
+    HazardPointerDomain domain(allocator);
+    AtomicPointer<my_Node> shared(new (*allocator) my_Node(1));
+
+    HazardPointerGuard guard(&domain);
+    my_Node* node = guard.protect(shared);
+    ASSERT_EQ(shared.loadRelaxed(), node);
+
+    shared.storeRelease(0);
+    domain.retire(node);
+    domain.reclaim();
+    EXPECT_EQ(1, g_num_live.load());
+    EXPECT_EQ(1, node->d_value);
+
+    guard.reset();
+    domain.reclaim();
+    EXPECT_EQ(0, g_num_live.load());
+    EXPECT_EQ(0, domain.numRetired());
+
+    domain.retire(new (*allocator) my_Node(2));
+  }
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+struct ReaderArgs {
+  HazardPointerDomain* d_domain_p;
+  AtomicPointer<my_Node>* d_shared_p;
+  AtomicInt d_protected;
+  AtomicInt d_leave;
+  int d_value;
+};
+
+void* stalledReader(void* arg) {
+  ReaderArgs* args = static_cast<ReaderArgs*>(arg);
+  {
+    HazardPointerGuard guard(args->d_domain_p);
+    my_Node* node = guard.protect(*args->d_shared_p);
+    args->d_protected = 1;
+    while (!args->d_leave.loadAcquire()) {
+      sched_yield();
+    }
+    args->d_value = node->d_value;
+  }
+  return 0;
+}
+
+TEST(HazardPointerDomainTest, StalledReaderKeepsMemoryBounded) {
+  Allocator* allocator = &NewDeleteAllocator::singleton();
+  g_num_live = 0;
+
+  HazardPointerDomain domain(allocator);
+  AtomicPointer<my_Node> shared(new (*allocator) my_Node(7));
+
+  ReaderArgs args;
+  args.d_domain_p = &domain;
+  args.d_shared_p = &shared;
+  args.d_value = 0;
+
+  pthread_t reader;
+  ASSERT_EQ(0, pthread_create(&reader, 0, &stalledReader, &args));
+  while (!args.d_protected.loadAcquire()) {
+    sched_yield();
+  }
+
+  // Keep replacing the shared node while the reader holds on to the first.
+  const int bound = HazardPointerDomain::RETIRE_THRESHOLD +
+                    2 * HazardPointerDomain::SLOTS_PER_THREAD * 2;
+  for (int i = 0; i < 10000; ++i) {
+    my_Node* old = shared.swapAcqRel(new (*allocator) my_Node(i));
+    domain.retire(old);
+    EXPECT_GT(bound, domain.numRetired());
+  }
+  EXPECT_GT(bound + 1, g_num_live.load());
+
+  args.d_leave.storeRelease(1);
+  pthread_join(reader, 0);
+  EXPECT_EQ(7, args.d_value);
+
+  allocator->deleteObject(shared.swapAcqRel(0));
+  domain.reclaim();
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+// A Treiber stack whose popped nodes are retired through the domain.
+class my_Stack {
+  AtomicPointer<my_Node> d_head;
+  HazardPointerDomain* d_domain_p;
+  Allocator* d_allocator_p;
+
+ public:
+  my_Stack(HazardPointerDomain* domain)
+      : d_domain_p(domain), d_allocator_p(domain->allocator()) {}
+
+  void push(int value) {
+    my_Node* node = new (*d_allocator_p) my_Node(value);
+    my_Node* head = d_head.loadAcquire();
+    for (;;) {
+      node->d_next_p = head;
+      my_Node* prev = d_head.testAndSwapAcqRel(head, node);
+      if (prev == head) {
+        return;
+      }
+      head = prev;
+    }
+  }
+
+  bool pop(int* value) {
+    HazardPointerGuard guard(d_domain_p);
+    for (;;) {
+      my_Node* head = guard.protect(d_head);
+      if (!head) {
+        return false;
+      }
+      if (head == d_head.testAndSwapAcqRel(head, head->d_next_p)) {
+        *value = head->d_value;
+        guard.reset();
+        d_domain_p->retire(head);
+        return true;
+      }
+    }
+  }
+};
+
+struct WorkerArgs {
+  my_Stack* d_stack_p;
+  int d_id;
+  bool d_ok;
+};
+
+void* worker(void* arg) {
+  WorkerArgs* args = static_cast<WorkerArgs*>(arg);
+  args->d_ok = true;
+  for (int i = 0; i < 20000; ++i) {
+    args->d_stack_p->push(args->d_id * 100000 + i);
+    int value;
+    if (!args->d_stack_p->pop(&value) || value < 0) {
+      args->d_ok = false;
+    }
+  }
+  return 0;
+}
+
+TEST(HazardPointerDomainTest, ConcurrentStack) {
+  g_num_live = 0;
+  {
+    HazardPointerDomain domain(&NewDeleteAllocator::singleton());
+    my_Stack stack(&domain);
+
+    const int k_num_threads = 4;
+    pthread_t threads[k_num_threads];
+    WorkerArgs args[k_num_threads];
+    for (int i = 0; i < k_num_threads; ++i) {
+      args[i].d_stack_p = &stack;
+      args[i].d_id = i;
+      ASSERT_EQ(0, pthread_create(&threads[i], 0, &worker, &args[i]));
+    }
+    for (int i = 0; i < k_num_threads; ++i) {
+      pthread_join(threads[i], 0);
+      EXPECT_TRUE(args[i].d_ok);
+    }
+
+    // No guard is left, so everything retired can go.
+    domain.reclaim();
+    EXPECT_EQ(0, g_num_live.load());
+  }
+  EXPECT_EQ(0, g_num_live.load());
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,78 @@
+#include "llcl/Standard/MultiThread/Latch.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Latch;
+
+TEST(LatchTest, Basic) {
+  Latch latch(3);
+  EXPECT_EQ(3, latch.currentCount());
+  EXPECT_FALSE(latch.tryWait());
+
+  latch.arrive();
+  latch.countDown(0);
+  EXPECT_EQ(2, latch.currentCount());
+  latch.countDown(2);
+  EXPECT_EQ(0, latch.currentCount());
+  EXPECT_TRUE(latch.tryWait());
+  latch.wait();
+
+  Latch open(0);
+  EXPECT_TRUE(open.tryWait());
+  open.wait();
+}
+
+struct my_Shared {
+  Latch* d_start_p;
+  Latch* d_done_p;
+  AtomicInt d_started;
+  AtomicInt d_errors;
+};
+
+void* my_work(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  shared->d_start_p->wait();
+  if (0 != shared->d_start_p->currentCount()) {
+    ++shared->d_errors;
+  }
+  ++shared->d_started;
+  shared->d_done_p->arriveAndWait();
+  return 0;
+}
+
+TEST(LatchTest, ReleasesAllWaiters) {
+  const int k_num_threads = 6;
+  Latch start(2);
+  Latch done(k_num_threads + 1);
+
+  my_Shared shared;
+  shared.d_start_p = &start;
+  shared.d_done_p = &done;
+
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_work, &shared));
+  }
+
+  sched_yield();
+  EXPECT_EQ(0, shared.d_started.load());
+  start.arrive();
+  sched_yield();
+  EXPECT_EQ(0, shared.d_started.load());
+  start.arrive();
+
+  done.arriveAndWait();
+  EXPECT_EQ(k_num_threads, shared.d_started.load());
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(0, shared.d_errors.load());
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,171 @@
+#include "llcl/Standard/MultiThread/MpmcQueue.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::MpmcQueue;
+
+TEST(MpmcQueueTest, Basic) {
+  MpmcQueue<int> queue(3);
+  EXPECT_EQ(4, queue.capacity());
+  EXPECT_EQ(0, queue.numElements());
+
+  int value = -1;
+  EXPECT_NE(0, queue.tryPop(&value));
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(0, queue.tryPush(i));
+  }
+  EXPECT_NE(0, queue.tryPush(4));
+  EXPECT_EQ(4, queue.numElements());
+
+  // Wrap around the ring a few times.
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(0, queue.tryPop(&value));
+    EXPECT_EQ(i, value);
+    ASSERT_EQ(0, queue.tryPush(i + 4));
+  }
+  for (int i = 20; i < 24; ++i) {
+    queue.pop(&value);
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_NE(0, queue.tryPop(&value));
+}
+
+struct my_Counted {
+  static AtomicInt s_live;
+
+  int d_value;
+
+  explicit my_Counted(int value = 0) : d_value(value) { s_live.add(1); }
+
+  my_Counted(const my_Counted& original) : d_value(original.d_value) {
+    s_live.add(1);
+  }
+
+  ~my_Counted() { s_live.subtract(1); }
+
+  my_Counted& operator=(const my_Counted& rhs) {
+    d_value = rhs.d_value;
+    return *this;
+  }
+};
+
+AtomicInt my_Counted::s_live(0);
+
+TEST(MpmcQueueTest, DestroysValues) {
+  {
+    MpmcQueue<my_Counted> queue(8);
+    for (int i = 0; i < 5; ++i) {
+      queue.push(my_Counted(i));
+    }
+    EXPECT_EQ(5, my_Counted::s_live.loadRelaxed());
+
+    my_Counted value;
+    queue.pop(&value);
+    EXPECT_EQ(0, value.d_value);
+    EXPECT_EQ(5, my_Counted::s_live.loadRelaxed());
+  }
+  EXPECT_EQ(0, my_Counted::s_live.loadRelaxed());
+}
+
+const int k_num_producers = 3;
+const int k_num_consumers = 3;
+const int k_num_items = 30000;  // per producer
+
+struct my_Shared {
+  MpmcQueue<int>* d_queue_p;
+  bool d_blocking;
+  AtomicInt d_next_producer;
+  long d_sums[k_num_consumers];
+  AtomicInt d_next_consumer;
+};
+
+// Push 'k_num_items' values tagged with the producer's index; the values of
+// each producer increase, so consumers can check the order.
+void* produce(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  const int id = shared->d_next_producer.add(1) - 1;
+  for (int i = 0; i < k_num_items; ++i) {
+    const int value = i * k_num_producers + id;
+    if (shared->d_blocking) {
+      shared->d_queue_p->push(value);
+    } else {
+      while (0 != shared->d_queue_p->tryPush(value)) {
+        sched_yield();
+      }
+    }
+  }
+  return 0;
+}
+
+void* consume(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  const int id = shared->d_next_consumer.add(1) - 1;
+  int last[k_num_producers];
+  for (int i = 0; i < k_num_producers; ++i) {
+    last[i] = -1;
+  }
+
+  long sum = 0;
+  for (int i = 0; i < k_num_items * k_num_producers / k_num_consumers; ++i) {
+    int value;
+    if (shared->d_blocking) {
+      shared->d_queue_p->pop(&value);
+    } else {
+      while (0 != shared->d_queue_p->tryPop(&value)) {
+        sched_yield();
+      }
+    }
+    EXPECT_LT(last[value % k_num_producers], value);
+    last[value % k_num_producers] = value;
+    sum += value;
+  }
+  shared->d_sums[id] = sum;
+  return 0;
+}
+
+void my_runProducersAndConsumers(bool blocking, int capacity) {
+  MpmcQueue<int> queue(capacity);
+  my_Shared shared;
+  shared.d_queue_p = &queue;
+  shared.d_blocking = blocking;
+  shared.d_next_producer.storeRelaxed(0);
+  shared.d_next_consumer.storeRelaxed(0);
+
+  pthread_t threads[k_num_producers + k_num_consumers];
+  for (int i = 0; i < k_num_consumers; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &consume, &shared));
+  }
+  for (int i = 0; i < k_num_producers; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[k_num_consumers + i], 0, &produce,
+                                &shared));
+  }
+  for (int i = 0; i < k_num_producers + k_num_consumers; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  const long n = static_cast<long>(k_num_items) * k_num_producers;
+  long sum = 0;
+  for (int i = 0; i < k_num_consumers; ++i) {
+    sum += shared.d_sums[i];
+  }
+  EXPECT_EQ(n * (n - 1) / 2, sum);
+  EXPECT_EQ(0, queue.numElements());
+}
+
+TEST(MpmcQueueTest, TryPushAndTryPop) { my_runProducersAndConsumers(false, 64); }
+
+TEST(MpmcQueueTest, BlockingPushAndPop) {
+  // A tiny queue makes producers and consumers block often.
+  my_runProducersAndConsumers(true, 2);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,134 @@
+#include "llcl/Standard/MultiThread/MpscQueue.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "llcl/Standard/ADT/ilist_base.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::MpscQueue;
+
+typedef ilist_node_base<false, void> Node;
+typedef ilist_base<false, void> List;
+
+struct my_Message : Node {
+  int d_producer;
+  int d_sequence;
+};
+
+my_Message* my_pop(MpscQueue<>* queue) {
+  return static_cast<my_Message*>(queue->pop());
+}
+
+TEST(MpscQueueTest, Basic) {
+  MpscQueue<> queue;
+  EXPECT_TRUE(queue.isEmpty());
+  EXPECT_EQ(0, queue.pop());
+
+  my_Message messages[3];
+  for (int i = 0; i < 3; ++i) {
+    messages[i].d_sequence = i;
+    queue.push(&messages[i]);
+  }
+  EXPECT_FALSE(queue.isEmpty());
+
+  EXPECT_EQ(&messages[0], my_pop(&queue));
+  EXPECT_EQ(&messages[1], my_pop(&queue));
+  queue.push(&messages[0]);
+  EXPECT_EQ(&messages[2], my_pop(&queue));
+  EXPECT_EQ(&messages[0], my_pop(&queue));
+  EXPECT_EQ(0, queue.pop());
+  EXPECT_TRUE(queue.isEmpty());
+
+  // The queue keeps working after draining.
+  queue.push(&messages[1]);
+  EXPECT_EQ(&messages[1], my_pop(&queue));
+  EXPECT_EQ(0, queue.pop());
+}
+
+TEST(MpscQueueTest, MovesBetweenListAndQueue) {
+  Node sentinel;
+  sentinel.setPrev(&sentinel);
+  sentinel.setNext(&sentinel);
+
+  my_Message messages[3];
+  for (int i = 0; i < 3; ++i) {
+    messages[i].d_sequence = i;
+    List::insertBeforeImpl(sentinel, messages[i]);
+  }
+
+  // Move every node from the list to the queue and back, in order.
+  MpscQueue<> queue;
+  while (sentinel.getNext() != &sentinel) {
+    Node* node = sentinel.getNext();
+    List::removeImpl(*node);
+    queue.push(node);
+  }
+  while (Node* node = queue.pop()) {
+    List::insertBeforeImpl(sentinel, *node);
+  }
+
+  int expected = 0;
+  for (Node* node = sentinel.getNext(); node != &sentinel;
+       node = node->getNext()) {
+    EXPECT_EQ(expected++, static_cast<my_Message*>(node)->d_sequence);
+  }
+  EXPECT_EQ(3, expected);
+}
+
+const int k_num_producers = 4;
+const int k_num_messages = 50000;  // per producer
+
+struct my_Producer {
+  MpscQueue<>* d_queue_p;
+  my_Message* d_messages_p;
+  int d_id;
+};
+
+void* produce(void* arg) {
+  my_Producer* producer = static_cast<my_Producer*>(arg);
+  for (int i = 0; i < k_num_messages; ++i) {
+    my_Message* message = &producer->d_messages_p[i];
+    message->d_producer = producer->d_id;
+    message->d_sequence = i;
+    producer->d_queue_p->push(message);
+  }
+  return 0;
+}
+
+TEST(MpscQueueTest, ManyProducers) {
+  MpscQueue<> queue;
+  my_Message* messages = new my_Message[k_num_producers * k_num_messages];
+  my_Producer producers[k_num_producers];
+  pthread_t threads[k_num_producers];
+  for (int i = 0; i < k_num_producers; ++i) {
+    producers[i].d_queue_p = &queue;
+    producers[i].d_messages_p = messages + i * k_num_messages;
+    producers[i].d_id = i;
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &produce, &producers[i]));
+  }
+
+  int next[k_num_producers] = {0};
+  for (int received = 0; received < k_num_producers * k_num_messages;) {
+    my_Message* message = my_pop(&queue);
+    if (!message) {
+      sched_yield();
+      continue;
+    }
+    ASSERT_EQ(next[message->d_producer], message->d_sequence);
+    ++next[message->d_producer];
+    ++received;
+  }
+  for (int i = 0; i < k_num_producers; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(0, queue.pop());
+  EXPECT_TRUE(queue.isEmpty());
+  delete[] messages;
+}
+
+}  // namespace
+}  // namespace llcl
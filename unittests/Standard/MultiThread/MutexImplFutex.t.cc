@@ -0,0 +1,71 @@
+#include "llcl/Standard/MultiThread/MutexImplFutex.h"
+
+#include <gtest/gtest.h>
+
+#ifdef LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using FutexMutex =
+    llcl::standard::mt::MutexImpl<llcl::standard::mt::Platform::FutexThreads>;
+
+TEST(MutexImplFutexTest, Basic) {
+  EXPECT_EQ(4u, sizeof(FutexMutex));
+
+  FutexMutex mutex;
+  EXPECT_EQ(0, mutex.try_lock());
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock();
+
+  mutex.lock();
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock();
+  EXPECT_EQ(0, mutex.native_mutex().load());
+}
+
+struct SharedCounter {
+  FutexMutex d_lock;
+  long d_value;
+};
+
+const int k_num_iterations = 100000;
+
+void* increment(void* arg) {
+  SharedCounter* counter = static_cast<SharedCounter*>(arg);
+  for (int i = 0; i < k_num_iterations; ++i) {
+    counter->d_lock.lock();
+    const long value = counter->d_value;
+    if (0 == i % 1000) {
+      sched_yield();  // get preempted while holding the lock
+    }
+    counter->d_value = value + 1;
+    counter->d_lock.unlock();
+  }
+  return 0;
+}
+
+TEST(MutexImplFutexTest, Contention) {
+  SharedCounter counter;
+  counter.d_value = 0;
+
+  const int k_num_threads = 4;
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &increment, &counter));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(k_num_threads * k_num_iterations, counter.d_value);
+  EXPECT_EQ(0, counter.d_lock.native_mutex().load());
+}
+
+}  // namespace
+}  // namespace llcl
+
+#endif  // LLCL_STANDARD_MT_PLATFORM_FUTEX_THREADS
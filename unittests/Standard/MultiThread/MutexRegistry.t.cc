@@ -0,0 +1,150 @@
+#include "llcl/Standard/MultiThread/MutexRegistry.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "llcl/Standard/MultiThread/MutexImplInstrumented.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::MutexImpl;
+using llcl::standard::mt::MutexRegistry;
+using llcl::standard::mt::MutexStats;
+using llcl::standard::mt::Platform;
+
+typedef MutexImpl<Platform::InstrumentedThreads> InstrumentedMutex;
+
+// Load the statistics of the mutex at the specified 'mutex' address into
+// the specified 'stats'.  Return 'false' if it is not registered.
+bool my_find(const void* mutex, MutexStats* stats) {
+  MutexStats all[64];
+  const int count = MutexRegistry::snapshot(all, 64);
+  for (int i = 0; i < count && i < 64; ++i) {
+    if (all[i].d_mutex_p == mutex) {
+      *stats = all[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST(MutexRegistryTest, RegistersWhileAlive) {
+  const void* address;
+  MutexStats stats;
+  {
+    InstrumentedMutex mutex("registry.alive");
+    address = &mutex;
+    ASSERT_TRUE(my_find(address, &stats));
+    EXPECT_STREQ("registry.alive", stats.d_name);
+    EXPECT_EQ(0u, stats.d_acquisitions);
+  }
+  EXPECT_FALSE(my_find(address, &stats));
+}
+
+TEST(MutexRegistryTest, CountsUncontendedAcquisitions) {
+  InstrumentedMutex mutex("registry.uncontended");
+  const int k_count = 3 * InstrumentedMutex::HOLD_SAMPLE_PERIOD;
+  for (int i = 0; i < k_count; ++i) {
+    mutex.lock();
+    mutex.unlock();
+  }
+  ASSERT_EQ(0, mutex.try_lock());
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock();
+
+  MutexStats stats;
+  ASSERT_TRUE(my_find(&mutex, &stats));
+  EXPECT_EQ(k_count + 1u, stats.d_acquisitions);
+  EXPECT_EQ(0u, stats.d_contended);
+  EXPECT_EQ(0u, stats.d_total_wait_ns);
+
+  // One hold in every sample period is timed.
+  unsigned long long holds = 0;
+  for (int i = 0; i < MutexStats::NUM_HOLD_BUCKETS; ++i) {
+    holds += stats.d_hold_ns[i];
+  }
+  EXPECT_EQ(3u, holds);
+}
+
+struct my_Holder {
+  InstrumentedMutex* d_mutex_p;
+  llcl::standard::AtomicBool d_locked;
+};
+
+void* holdBriefly(void* arg) {
+  my_Holder* holder = static_cast<my_Holder*>(arg);
+  holder->d_mutex_p->lock();
+  holder->d_locked.storeRelease(true);
+  usleep(20000);
+  holder->d_mutex_p->unlock();
+  return 0;
+}
+
+TEST(MutexRegistryTest, RecordsContention) {
+  InstrumentedMutex mutex("registry.contended");
+  my_Holder holder;
+  holder.d_mutex_p = &mutex;
+  holder.d_locked.storeRelaxed(false);
+
+  pthread_t thread;
+  ASSERT_EQ(0, pthread_create(&thread, 0, &holdBriefly, &holder));
+  while (!holder.d_locked.loadAcquire()) {
+    sched_yield();
+  }
+  mutex.lock();
+  mutex.unlock();
+  pthread_join(thread, 0);
+
+  MutexStats stats;
+  ASSERT_TRUE(my_find(&mutex, &stats));
+  EXPECT_EQ(2u, stats.d_acquisitions);
+  EXPECT_EQ(1u, stats.d_contended);
+  EXPECT_LE(1000000u, stats.d_max_wait_ns);
+  EXPECT_EQ(stats.d_max_wait_ns, stats.d_total_wait_ns);
+
+  // Only the contended hold was timed.
+  unsigned long long holds = 0;
+  for (int i = 0; i < MutexStats::NUM_HOLD_BUCKETS; ++i) {
+    holds += stats.d_hold_ns[i];
+  }
+  EXPECT_EQ(1u, holds);
+  EXPECT_LT(0u, stats.holdPercentile(50));
+}
+
+TEST(MutexRegistryTest, HoldPercentile) {
+  MutexStats stats;
+  memset(&stats, 0, sizeof stats);
+  EXPECT_EQ(0u, stats.holdPercentile(50));
+
+  stats.d_hold_ns[4] = 90;   // [16, 32)
+  stats.d_hold_ns[10] = 10;  // [1024, 2048)
+  EXPECT_EQ(32u, stats.holdPercentile(50));
+  EXPECT_EQ(32u, stats.holdPercentile(90));
+  EXPECT_EQ(2048u, stats.holdPercentile(99));
+}
+
+TEST(MutexRegistryTest, Print) {
+  InstrumentedMutex named("registry.print");
+  InstrumentedMutex unnamed;
+  named.lock();
+  named.unlock();
+
+  char buffer[4096];
+  FILE* stream = fmemopen(buffer, sizeof buffer, "w");
+  ASSERT_TRUE(stream);
+  MutexRegistry::print(stream);
+  fclose(stream);
+
+  EXPECT_TRUE(strstr(buffer, "registry.print"));
+  char address[32];
+  snprintf(address, sizeof address, "%p", static_cast<void*>(&unnamed));
+  EXPECT_TRUE(strstr(buffer, address));
+}
+
+}  // namespace
+}  // namespace llcl
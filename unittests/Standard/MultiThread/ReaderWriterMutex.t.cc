@@ -0,0 +1,148 @@
+#include "llcl/Standard/MultiThread/ReaderWriterMutex.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::ReaderWriterMutex;
+using llcl::standard::mt::ReaderWriterMutexImpl;
+
+template <class MUTEX>
+class ReaderWriterMutexTest : public ::testing::Test {};
+
+typedef ::testing::Types<ReaderWriterMutex,
+                         ReaderWriterMutexImpl<Platform::ReaderBiased> >
+    my_MutexTypes;
+TYPED_TEST_SUITE(ReaderWriterMutexTest, my_MutexTypes);
+
+TYPED_TEST(ReaderWriterMutexTest, Basic) {
+  TypeParam mutex;
+
+  EXPECT_EQ(0, mutex.try_lock_shared());
+  EXPECT_EQ(0, mutex.try_lock_shared());
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock_shared();
+  EXPECT_NE(0, mutex.try_lock());
+  mutex.unlock_shared();
+
+  EXPECT_EQ(0, mutex.try_lock());
+  EXPECT_NE(0, mutex.try_lock_shared());
+  mutex.unlock();
+
+  mutex.lock();
+  mutex.unlock();
+  mutex.lock_shared();
+  mutex.unlock_shared();
+}
+
+template <class MUTEX>
+struct my_Shared {
+  MUTEX d_mutex;
+  long d_first;
+  long d_second;
+  AtomicInt d_torn;
+  AtomicInt d_writer_done;
+};
+
+template <class MUTEX>
+void* my_write(void* arg) {
+  my_Shared<MUTEX>* shared = static_cast<my_Shared<MUTEX>*>(arg);
+  for (int i = 0; i < 2000; ++i) {
+    shared->d_mutex.lock();
+    ++shared->d_first;
+    if (0 == i % 100) {
+      sched_yield();  // get preempted while holding the lock
+    }
+    ++shared->d_second;
+    shared->d_mutex.unlock();
+  }
+  return 0;
+}
+
+template <class MUTEX>
+void* my_read(void* arg) {
+  my_Shared<MUTEX>* shared = static_cast<my_Shared<MUTEX>*>(arg);
+  for (int i = 0; i < 20000; ++i) {
+    shared->d_mutex.lock_shared();
+    if (shared->d_first != shared->d_second) {
+      ++shared->d_torn;
+    }
+    shared->d_mutex.unlock_shared();
+  }
+  return 0;
+}
+
+TYPED_TEST(ReaderWriterMutexTest, ReadersSeeConsistentState) {
+  my_Shared<TypeParam> shared;
+  shared.d_first = 0;
+  shared.d_second = 0;
+
+  const int k_num_readers = 6;
+  const int k_num_writers = 2;
+  pthread_t threads[k_num_readers + k_num_writers];
+  for (int i = 0; i < k_num_readers; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_read<TypeParam>, &shared));
+  }
+  for (int i = k_num_readers; i < k_num_readers + k_num_writers; ++i) {
+    ASSERT_EQ(0,
+              pthread_create(&threads[i], 0, &my_write<TypeParam>, &shared));
+  }
+  for (int i = 0; i < k_num_readers + k_num_writers; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(0, shared.d_torn.load());
+  EXPECT_EQ(k_num_writers * 2000, shared.d_first);
+  EXPECT_EQ(k_num_writers * 2000, shared.d_second);
+}
+
+template <class MUTEX>
+void* my_writeOnce(void* arg) {
+  my_Shared<MUTEX>* shared = static_cast<my_Shared<MUTEX>*>(arg);
+  shared->d_mutex.lock();
+  shared->d_writer_done = 1;
+  shared->d_mutex.unlock();
+  return 0;
+}
+
+TYPED_TEST(ReaderWriterMutexTest, WaitingWriterBlocksNewReaders) {
+  my_Shared<TypeParam> shared;
+  shared.d_mutex.lock_shared();
+
+  pthread_t writer;
+  ASSERT_EQ(0,
+            pthread_create(&writer, 0, &my_writeOnce<TypeParam>, &shared));
+
+  // Once the writer is waiting, further read locks must fail even though
+  // only readers hold the lock.
+  bool blocked = false;
+  for (int i = 0; i < 1000000 && !blocked; ++i) {
+    if (0 == shared.d_mutex.try_lock_shared()) {
+      shared.d_mutex.unlock_shared();
+      sched_yield();
+    } else {
+      blocked = true;
+    }
+  }
+  EXPECT_TRUE(blocked);
+  EXPECT_EQ(0, shared.d_writer_done.load());
+
+  shared.d_mutex.unlock_shared();
+  pthread_join(writer, 0);
+  EXPECT_EQ(1, shared.d_writer_done.load());
+}
+
+TEST(ReaderWriterMutexImplTest, ReaderSlotsArePadded) {
+  typedef ReaderWriterMutexImpl<Platform::ReaderBiased> Obj;
+  EXPECT_LE((Obj::NUM_SLOTS + 1) * static_cast<int>(Platform::CACHE_LINE_SIZE),
+            static_cast<int>(sizeof(Obj)));
+  EXPECT_EQ(0u, alignof(Obj) % Platform::CACHE_LINE_SIZE);
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,124 @@
+#include "llcl/Standard/MultiThread/Semaphore.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::Semaphore;
+using llcl::standard::mt::SemaphoreImpl;
+
+template <class SEMAPHORE>
+class SemaphoreTest : public ::testing::Test {};
+
+typedef ::testing::Types<Semaphore, SemaphoreImpl<Platform::PosixSemaphore>,
+                         SemaphoreImpl<Platform::CountedSemaphore> >
+    my_SemaphoreTypes;
+TYPED_TEST_SUITE(SemaphoreTest, my_SemaphoreTypes);
+
+TYPED_TEST(SemaphoreTest, Basic) {
+  TypeParam sem(2);
+  EXPECT_EQ(2, sem.getValue());
+
+  EXPECT_EQ(0, sem.tryWait());
+  sem.wait();
+  EXPECT_EQ(0, sem.getValue());
+  EXPECT_NE(0, sem.tryWait());
+
+  sem.post();
+  EXPECT_EQ(1, sem.getValue());
+  sem.post(3);
+  EXPECT_EQ(4, sem.getValue());
+  sem.post(0);
+  EXPECT_EQ(4, sem.getValue());
+
+  for (int i = 0; i < 4; ++i) {
+    sem.wait();
+  }
+  EXPECT_NE(0, sem.tryWait());
+}
+
+template <class SEMAPHORE>
+struct my_Shared {
+  SEMAPHORE d_items;
+  AtomicInt d_consumed;
+};
+
+const int k_num_items = 20000;
+
+template <class SEMAPHORE>
+void* my_consume(void* arg) {
+  my_Shared<SEMAPHORE>* shared = static_cast<my_Shared<SEMAPHORE>*>(arg);
+  for (int i = 0; i < k_num_items; ++i) {
+    shared->d_items.wait();
+    ++shared->d_consumed;
+  }
+  return 0;
+}
+
+template <class SEMAPHORE>
+void* my_produce(void* arg) {
+  my_Shared<SEMAPHORE>* shared = static_cast<my_Shared<SEMAPHORE>*>(arg);
+  for (int i = 0; i < k_num_items; i += 4) {
+    if (i % 8) {
+      shared->d_items.post(4);
+    } else {
+      for (int j = 0; j < 4; ++j) {
+        shared->d_items.post();
+      }
+    }
+  }
+  return 0;
+}
+
+TYPED_TEST(SemaphoreTest, ProducersAndConsumers) {
+  my_Shared<TypeParam> shared;
+
+  const int k_num_pairs = 3;
+  pthread_t threads[2 * k_num_pairs];
+  for (int i = 0; i < k_num_pairs; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[2 * i], 0, &my_consume<TypeParam>,
+                                &shared));
+    ASSERT_EQ(0, pthread_create(&threads[2 * i + 1], 0,
+                                &my_produce<TypeParam>, &shared));
+  }
+  for (int i = 0; i < 2 * k_num_pairs; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(k_num_pairs * k_num_items, shared.d_consumed.load());
+  EXPECT_EQ(0, shared.d_items.getValue());
+}
+
+template <class SEMAPHORE>
+void* my_waitOnce(void* arg) {
+  my_Shared<SEMAPHORE>* shared = static_cast<my_Shared<SEMAPHORE>*>(arg);
+  shared->d_items.wait();
+  ++shared->d_consumed;
+  return 0;
+}
+
+TYPED_TEST(SemaphoreTest, BatchedPostWakesWaiters) {
+  my_Shared<TypeParam> shared;
+
+  const int k_num_waiters = 5;
+  pthread_t threads[k_num_waiters];
+  for (int i = 0; i < k_num_waiters; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_waitOnce<TypeParam>,
+                                &shared));
+  }
+
+  shared.d_items.post(k_num_waiters + 2);
+  for (int i = 0; i < k_num_waiters; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  EXPECT_EQ(k_num_waiters, shared.d_consumed.load());
+  EXPECT_EQ(2, shared.d_items.getValue());
+}
+
+}  // namespace
+}  // namespace llcl
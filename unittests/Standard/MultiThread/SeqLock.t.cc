@@ -0,0 +1,98 @@
+#include "llcl/Standard/MultiThread/SeqLock.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::SeqLock;
+
+// An odd-sized record, so the last payload word is only partly used.
+struct my_Record {
+  long d_first;
+  int d_middle;
+  long d_last;
+  char d_tag;
+};
+
+TEST(SeqLockTest, Basic) {
+  SeqLock<my_Record> lock;
+  EXPECT_EQ(0u, lock.sequence());
+  my_Record record = lock.load();
+  EXPECT_EQ(0, record.d_first);
+  EXPECT_EQ(0, record.d_tag);
+
+  const my_Record value = {1, 2, 3, 'x'};
+  lock.store(value);
+  EXPECT_EQ(2u, lock.sequence());
+
+  ASSERT_TRUE(lock.tryLoad(&record));
+  EXPECT_EQ(1, record.d_first);
+  EXPECT_EQ(2, record.d_middle);
+  EXPECT_EQ(3, record.d_last);
+  EXPECT_EQ('x', record.d_tag);
+
+  SeqLock<int> small(42);
+  EXPECT_EQ(42, small.load());
+  small.store(7);
+  EXPECT_EQ(7, small.load());
+}
+
+const int k_num_writes = 20000;
+
+struct my_Shared {
+  SeqLock<my_Record> d_lock;
+  AtomicInt d_done;
+  AtomicInt d_torn;
+};
+
+void* my_write(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  for (int i = 1; i <= k_num_writes; ++i) {
+    const my_Record record = {i, i, i, static_cast<char>(i)};
+    shared->d_lock.store(record);
+  }
+  ++shared->d_done;
+  return 0;
+}
+
+void* my_read(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  while (shared->d_done.load() < 2) {
+    const my_Record record = shared->d_lock.load();
+    if (record.d_first != record.d_middle || record.d_first != record.d_last ||
+        static_cast<char>(record.d_first) != record.d_tag) {
+      ++shared->d_torn;
+    }
+  }
+  return 0;
+}
+
+TEST(SeqLockTest, ReadersNeverSeeTornRecords) {
+  my_Shared shared;
+
+  const int k_num_readers = 4;
+  pthread_t readers[k_num_readers];
+  pthread_t writers[2];
+  for (int i = 0; i < k_num_readers; ++i) {
+    ASSERT_EQ(0, pthread_create(&readers[i], 0, &my_read, &shared));
+  }
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(0, pthread_create(&writers[i], 0, &my_write, &shared));
+  }
+  for (int i = 0; i < 2; ++i) {
+    pthread_join(writers[i], 0);
+  }
+  for (int i = 0; i < k_num_readers; ++i) {
+    pthread_join(readers[i], 0);
+  }
+
+  EXPECT_EQ(0, shared.d_torn.load());
+  EXPECT_EQ(4u * k_num_writes, shared.d_lock.sequence());
+  EXPECT_EQ(k_num_writes, shared.d_lock.load().d_last);
+}
+
+}  // namespace
+}  // namespace llcl
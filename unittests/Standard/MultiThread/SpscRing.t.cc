@@ -0,0 +1,163 @@
+#include "llcl/Standard/MultiThread/SpscRing.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::SpscRing;
+
+TEST(SpscRingTest, Basic) {
+  SpscRing<int> ring(5);
+  EXPECT_EQ(8, ring.capacity());
+  EXPECT_EQ(0, ring.numElements());
+
+  int value = -1;
+  EXPECT_NE(0, ring.tryPop(&value));
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(0, ring.tryPush(i));
+  }
+  EXPECT_NE(0, ring.tryPush(8));
+  EXPECT_EQ(8, ring.numElements());
+
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(0, ring.tryPop(&value));
+    EXPECT_EQ(i, value);
+    ASSERT_EQ(0, ring.tryPush(i + 8));
+  }
+}
+
+TEST(SpscRingTest, Batches) {
+  SpscRing<int> ring(8);
+  const int k_values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  EXPECT_EQ(6, ring.pushN(k_values, 6));
+  int out[10];
+  EXPECT_EQ(4, ring.popN(out, 4));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(i, out[i]);
+  }
+
+  // Only 6 slots are free, and the batch wraps around the end.
+  EXPECT_EQ(6, ring.pushN(k_values + 6, 4) + ring.pushN(k_values, 2));
+  EXPECT_EQ(0, ring.pushN(k_values, 1));
+  EXPECT_EQ(8, ring.popN(out, 10));
+  const int k_expected[] = {4, 5, 6, 7, 8, 9, 0, 1};
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(k_expected[i], out[i]);
+  }
+  EXPECT_EQ(0, ring.popN(out, 10));
+}
+
+TEST(SpscRingTest, ReserveAndPeek) {
+  SpscRing<int> ring(8);
+  int* slots;
+  int* values;
+
+  EXPECT_EQ(0, ring.peek(&values, 8));
+  ASSERT_EQ(5, ring.reserve(&slots, 5));
+  for (int i = 0; i < 5; ++i) {
+    slots[i] = 10 + i;
+  }
+  ring.commit(3);  // the last two slots stay unpublished
+  EXPECT_EQ(3, ring.numElements());
+
+  ASSERT_EQ(3, ring.peek(&values, 8));
+  EXPECT_EQ(10, values[0]);
+  EXPECT_EQ(12, values[2]);
+  ring.consume(3);
+
+  // The free space is contiguous only up to the end of the buffer.
+  ASSERT_EQ(5, ring.reserve(&slots, 8));
+  ring.commit(5);
+  ASSERT_EQ(3, ring.reserve(&slots, 8));
+  ring.commit(3);
+  EXPECT_EQ(0, ring.reserve(&slots, 8));
+
+  ASSERT_EQ(5, ring.peek(&values, 8));
+  ring.consume(5);
+  ASSERT_EQ(3, ring.peek(&values, 8));
+  ring.consume(3);
+  EXPECT_EQ(0, ring.numElements());
+}
+
+const int k_num_values = 1000000;
+
+void* produce(void* arg) {
+  SpscRing<int>* ring = static_cast<SpscRing<int>*>(arg);
+  int batch[7];
+  int next = 0;
+  while (next < k_num_values) {
+    // Alternate between single pushes, batches and in-place writes.
+    switch (next % 3) {
+      case 0:
+        if (0 == ring->tryPush(next)) {
+          ++next;
+          continue;
+        }
+        break;
+      case 1: {
+        int count = 0;
+        while (count < 7 && next + count < k_num_values) {
+          batch[count] = next + count;
+          ++count;
+        }
+        const int pushed = ring->pushN(batch, count);
+        next += pushed;
+        if (pushed) {
+          continue;
+        }
+      } break;
+      default: {
+        int* slots;
+        int count = ring->reserve(&slots, k_num_values - next);
+        for (int i = 0; i < count; ++i) {
+          slots[i] = next + i;
+        }
+        ring->commit(count);
+        next += count;
+        if (count) {
+          continue;
+        }
+      }
+    }
+    sched_yield();
+  }
+  return 0;
+}
+
+TEST(SpscRingTest, ProducerAndConsumer) {
+  SpscRing<int> ring(64);
+  pthread_t thread;
+  ASSERT_EQ(0, pthread_create(&thread, 0, &produce, &ring));
+
+  int expected = 0;
+  int batch[5];
+  while (expected < k_num_values) {
+    int count;
+    if (expected % 2) {
+      count = ring.popN(batch, 5);
+      for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(expected + i, batch[i]);
+      }
+    } else {
+      int* values;
+      count = ring.peek(&values, 16);
+      for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(expected + i, values[i]);
+      }
+      ring.consume(count);
+    }
+    expected += count;
+    if (0 == count) {
+      sched_yield();
+    }
+  }
+  pthread_join(thread, 0);
+  EXPECT_EQ(0, ring.numElements());
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,170 @@
+#include "llcl/Standard/MultiThread/ThreadPool.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include "llcl/Standard/MultiThread/Latch.h"
+#include "llcl/Standard/MultiThread/SpinUtil.h"
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Latch;
+using llcl::standard::mt::SpinUtil;
+using llcl::standard::mt::ThreadPool;
+
+struct my_Counter {
+  AtomicInt d_count;
+  Latch* d_done_p;
+};
+
+void increment(void* arg) {
+  my_Counter* counter = static_cast<my_Counter*>(arg);
+  counter->d_count.add(1);
+  counter->d_done_p->arrive();
+}
+
+TEST(ThreadPoolTest, RunsSubmittedTasks) {
+  const int k_num_tasks = 1000;
+  ThreadPool pool(4);
+  EXPECT_EQ(4, pool.numThreads());
+
+  Latch done(k_num_tasks);
+  my_Counter counter;
+  counter.d_count.storeRelaxed(0);
+  counter.d_done_p = &done;
+
+  ThreadPool::Task* tasks = new ThreadPool::Task[k_num_tasks];
+  for (int i = 0; i < k_num_tasks; ++i) {
+    tasks[i] = ThreadPool::Task(&increment, &counter);
+    pool.submit(&tasks[i]);
+  }
+  done.wait();
+  EXPECT_EQ(k_num_tasks, counter.d_count.loadRelaxed());
+  delete[] tasks;
+}
+
+// Sum '[d_begin, d_end)' by splitting it in two until it is small, in the
+// style of a fork/join computation.
+struct my_Sum {
+  ThreadPool* d_pool_p;
+  long d_begin;
+  long d_end;
+  long d_result;
+  AtomicInt* d_pending_p;  // decremented when done
+};
+
+void sum(void* arg) {
+  my_Sum* range = static_cast<my_Sum*>(arg);
+  if (range->d_end - range->d_begin <= 16) {
+    range->d_result = 0;
+    for (long i = range->d_begin; i < range->d_end; ++i) {
+      range->d_result += i;
+    }
+  } else {
+    const long middle = range->d_begin + (range->d_end - range->d_begin) / 2;
+    AtomicInt pending(2);
+    my_Sum halves[2] = {
+        {range->d_pool_p, range->d_begin, middle, 0, &pending},
+        {range->d_pool_p, middle, range->d_end, 0, &pending}};
+    ThreadPool::Task tasks[2] = {ThreadPool::Task(&sum, &halves[0]),
+                                 ThreadPool::Task(&sum, &halves[1])};
+    range->d_pool_p->submit(&tasks[1]);
+    range->d_pool_p->submit(&tasks[0]);
+
+    // Help with pending work instead of blocking the worker.
+    int spins = 0;
+    while (0 != pending.loadAcquire()) {
+      if (!range->d_pool_p->executePendingTask()) {
+        SpinUtil::pauseOrYield(&spins);
+      }
+    }
+    range->d_result = halves[0].d_result + halves[1].d_result;
+  }
+  range->d_pending_p->subtractAcqRel(1);
+}
+
+TEST(ThreadPoolTest, ForkJoin) {
+  const int k_thread_counts[] = {1, 2, 4};
+  for (int n = 0; n < 3; ++n) {
+    ThreadPool pool(k_thread_counts[n]);
+    const long k_end = 100000;
+    AtomicInt pending(1);
+    my_Sum range = {&pool, 0, k_end, 0, &pending};
+    ThreadPool::Task task(&sum, &range);
+    pool.submit(&task);
+
+    int spins = 0;
+    while (0 != pending.loadAcquire()) {
+      if (!pool.executePendingTask()) {
+        SpinUtil::pauseOrYield(&spins);
+      }
+    }
+    EXPECT_EQ(k_end * (k_end - 1) / 2, range.d_result);
+  }
+}
+
+void count(void* arg) { static_cast<AtomicInt*>(arg)->add(1); }
+
+TEST(ThreadPoolTest, DestructorRunsPendingTasks) {
+  const int k_num_tasks = 500;
+  AtomicInt counter(0);
+  ThreadPool::Task* tasks = new ThreadPool::Task[k_num_tasks];
+  {
+    ThreadPool pool(2);
+    for (int i = 0; i < k_num_tasks; ++i) {
+      tasks[i] = ThreadPool::Task(&count, &counter);
+      pool.submit(&tasks[i]);
+    }
+  }
+  EXPECT_EQ(k_num_tasks, counter.loadRelaxed());
+  delete[] tasks;
+}
+
+struct my_Submitter {
+  ThreadPool* d_pool_p;
+  ThreadPool::Task* d_tasks_p;
+  int d_num_tasks;
+};
+
+void* submitAll(void* arg) {
+  my_Submitter* submitter = static_cast<my_Submitter*>(arg);
+  for (int i = 0; i < submitter->d_num_tasks; ++i) {
+    submitter->d_pool_p->submit(&submitter->d_tasks_p[i]);
+  }
+  return 0;
+}
+
+TEST(ThreadPoolTest, ConcurrentExternalSubmitters) {
+  const int k_num_submitters = 4;
+  const int k_num_tasks = 2000;
+  ThreadPool pool(3);
+  Latch done(k_num_submitters * k_num_tasks);
+  my_Counter counter;
+  counter.d_count.storeRelaxed(0);
+  counter.d_done_p = &done;
+
+  ThreadPool::Task* tasks = new ThreadPool::Task[k_num_submitters * k_num_tasks];
+  my_Submitter submitters[k_num_submitters];
+  pthread_t threads[k_num_submitters];
+  for (int i = 0; i < k_num_submitters; ++i) {
+    submitters[i].d_pool_p = &pool;
+    submitters[i].d_tasks_p = tasks + i * k_num_tasks;
+    submitters[i].d_num_tasks = k_num_tasks;
+    for (int j = 0; j < k_num_tasks; ++j) {
+      submitters[i].d_tasks_p[j] = ThreadPool::Task(&increment, &counter);
+    }
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &submitAll, &submitters[i]));
+  }
+  for (int i = 0; i < k_num_submitters; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  done.wait();
+  EXPECT_EQ(k_num_submitters * k_num_tasks, counter.d_count.loadRelaxed());
+  delete[] tasks;
+}
+
+}  // namespace
+}  // namespace llcl
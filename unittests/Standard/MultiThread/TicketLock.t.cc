@@ -0,0 +1,85 @@
+#include "llcl/Standard/MultiThread/TicketLock.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
+
+namespace llcl {
+namespace {
+
+using llcl::standard::mt::TicketLock;
+
+TEST(TicketLockTest, Basic) {
+  TicketLock lock;
+  lock.lock();
+  lock.unlock();
+
+  EXPECT_EQ(0, lock.try_lock());
+  EXPECT_NE(0, lock.try_lock());
+  lock.unlock();
+
+  lock.lock();
+  lock.unlock();
+}
+
+struct SharedCounter {
+  TicketLock* d_lock_p;
+  long d_value;
+};
+
+const int k_num_iterations = 20000;
+
+void* increment(void* arg) {
+  SharedCounter* counter = static_cast<SharedCounter*>(arg);
+  for (int i = 0; i < k_num_iterations; ++i) {
+    counter->d_lock_p->lock();
+    const long value = counter->d_value;
+    if (0 == i % 1000) {
+      sched_yield();  // get preempted while holding the lock
+    }
+    counter->d_value = value + 1;
+    counter->d_lock_p->unlock();
+  }
+  return 0;
+}
+
+void* tryIncrement(void* arg) {
+  SharedCounter* counter = static_cast<SharedCounter*>(arg);
+  for (int i = 0; i < k_num_iterations; ++i) {
+    while (0 != counter->d_lock_p->try_lock()) {
+      sched_yield();
+    }
+    const long value = counter->d_value;
+    counter->d_value = value + 1;
+    counter->d_lock_p->unlock();
+  }
+  return 0;
+}
+
+// Run 4 threads incrementing a shared counter; with the specified
+// 'use_try_lock', half of them only ever acquire the lock with 'try_lock'.
+void runContention(bool use_try_lock) {
+  TicketLock lock;
+  SharedCounter counter;
+  counter.d_lock_p = &lock;
+  counter.d_value = 0;
+
+  const int k_num_threads = 4;
+  pthread_t threads[k_num_threads];
+  for (int i = 0; i < k_num_threads; ++i) {
+    void* (*function)(void*) =
+        use_try_lock && i % 2 ? &tryIncrement : &increment;
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, function, &counter));
+  }
+  for (int i = 0; i < k_num_threads; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(k_num_threads * k_num_iterations, counter.d_value);
+}
+
+TEST(TicketLockTest, Contention) { runContention(false); }
+
+TEST(TicketLockTest, ContentionWithTryLock) { runContention(true); }
+
+}  // namespace
+}  // namespace llcl
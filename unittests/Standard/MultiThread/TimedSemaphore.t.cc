@@ -0,0 +1,115 @@
+#include "llcl/Standard/MultiThread/TimedSemaphore.h"
+
+#include <errno.h>
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::Platform;
+using llcl::standard::mt::TimedSemaphore;
+using llcl::standard::mt::TimedSemaphoreImpl;
+
+// Return the time of the specified 'clock' the specified 'millis' from now.
+timespec my_deadline(clockid_t clock, long millis) {
+  timespec deadline;
+  clock_gettime(clock, &deadline);
+  deadline.tv_sec += millis / 1000;
+  deadline.tv_nsec += (millis % 1000) * 1000000;
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_nsec -= 1000000000;
+    ++deadline.tv_sec;
+  }
+  return deadline;
+}
+
+bool my_reached(clockid_t clock, const timespec& deadline) {
+  timespec now;
+  clock_gettime(clock, &now);
+  return now.tv_sec > deadline.tv_sec ||
+         (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec);
+}
+
+template <class SEMAPHORE>
+class TimedSemaphoreTest : public ::testing::Test {};
+
+typedef ::testing::Types<
+#ifdef LLCL_STANDARD_MT_PLATFORM_POSIX_ADV_TIMED_SEMAPHORE
+    TimedSemaphoreImpl<Platform::PosixAdvTimedSemaphore>,
+#endif
+    TimedSemaphoreImpl<Platform::PthreadTimedSemaphore>, TimedSemaphore>
+    my_SemaphoreTypes;
+TYPED_TEST_SUITE(TimedSemaphoreTest, my_SemaphoreTypes);
+
+TYPED_TEST(TimedSemaphoreTest, Basic) {
+  TypeParam sem(1);
+  EXPECT_EQ(CLOCK_MONOTONIC, sem.clockType());
+  EXPECT_EQ(1, sem.getValue());
+  EXPECT_EQ(0, sem.tryWait());
+  EXPECT_NE(0, sem.tryWait());
+
+  sem.post(3);
+  EXPECT_EQ(3, sem.getValue());
+  sem.wait();
+  EXPECT_EQ(0, sem.timedWait(my_deadline(CLOCK_MONOTONIC, 1000)));
+  sem.post();
+  EXPECT_EQ(2, sem.getValue());
+}
+
+TYPED_TEST(TimedSemaphoreTest, TimesOut) {
+  const clockid_t k_clocks[] = {CLOCK_MONOTONIC, CLOCK_REALTIME};
+  for (int i = 0; i < 2; ++i) {
+    TypeParam sem(0, k_clocks[i]);
+    EXPECT_EQ(k_clocks[i], sem.clockType());
+
+    const timespec deadline = my_deadline(k_clocks[i], 20);
+    EXPECT_EQ(ETIMEDOUT, sem.timedWait(deadline));
+    EXPECT_TRUE(my_reached(k_clocks[i], deadline));
+
+    // A deadline in the past still takes an available unit.
+    sem.post();
+    EXPECT_EQ(0, sem.timedWait(deadline));
+    EXPECT_EQ(0, sem.getValue());
+  }
+}
+
+template <class SEMAPHORE>
+struct my_Shared {
+  SEMAPHORE d_sem;
+  AtomicInt d_acquired;
+};
+
+template <class SEMAPHORE>
+void* my_timedWait(void* arg) {
+  my_Shared<SEMAPHORE>* shared = static_cast<my_Shared<SEMAPHORE>*>(arg);
+  if (0 == shared->d_sem.timedWait(my_deadline(CLOCK_MONOTONIC, 60000))) {
+    ++shared->d_acquired;
+  }
+  return 0;
+}
+
+TYPED_TEST(TimedSemaphoreTest, PostWakesTimedWaiters) {
+  my_Shared<TypeParam> shared;
+
+  const int k_num_waiters = 4;
+  pthread_t threads[k_num_waiters];
+  for (int i = 0; i < k_num_waiters; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &my_timedWait<TypeParam>,
+                                &shared));
+  }
+
+  shared.d_sem.post();
+  shared.d_sem.post(k_num_waiters - 1);
+  for (int i = 0; i < k_num_waiters; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  EXPECT_EQ(k_num_waiters, shared.d_acquired.load());
+  EXPECT_EQ(0, shared.d_sem.getValue());
+}
+
+}  // namespace
+}  // namespace llcl
@@ -0,0 +1,115 @@
+#include "llcl/Standard/MultiThread/WorkStealingDeque.h"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include "llcl/Standard/System/Atomic.h"
+
+namespace llcl {
+namespace {
+
+using llcl::standard::AtomicBool;
+using llcl::standard::AtomicInt;
+using llcl::standard::mt::WorkStealingDeque;
+
+TEST(WorkStealingDequeTest, OwnerIsLifoThievesAreFifo) {
+  WorkStealingDeque<int> deque;
+  int values[4] = {0, 1, 2, 3};
+
+  EXPECT_EQ(0, deque.pop());
+  EXPECT_EQ(0, deque.steal());
+
+  for (int i = 0; i < 4; ++i) {
+    deque.push(&values[i]);
+  }
+  EXPECT_EQ(4, deque.size());
+  EXPECT_EQ(&values[3], deque.pop());
+  EXPECT_EQ(&values[0], deque.steal());
+  EXPECT_EQ(&values[2], deque.pop());
+  EXPECT_EQ(&values[1], deque.steal());
+  EXPECT_EQ(0, deque.pop());
+  EXPECT_EQ(0, deque.steal());
+  EXPECT_EQ(0, deque.size());
+}
+
+TEST(WorkStealingDequeTest, Grows) {
+  WorkStealingDeque<int> deque;
+  const int k_count = 10 * WorkStealingDeque<int>::INITIAL_CAPACITY;
+  static int values[k_count];
+
+  // Interleave steals so that the live range wraps around the buffer.
+  for (int i = 0; i < k_count; ++i) {
+    deque.push(&values[i]);
+    if (0 == i % 3) {
+      EXPECT_EQ(&values[i / 3], deque.steal());
+    }
+  }
+  for (int i = k_count - 1; i >= (k_count + 2) / 3; --i) {
+    EXPECT_EQ(&values[i], deque.pop());
+  }
+  EXPECT_EQ(0, deque.pop());
+}
+
+const int k_num_items = 100000;
+const int k_num_thieves = 3;
+
+struct my_Shared {
+  WorkStealingDeque<int> d_deque;
+  int d_items[k_num_items];
+  AtomicInt d_taken[k_num_items];
+  AtomicBool d_done;
+};
+
+void take(my_Shared* shared, int* item) {
+  shared->d_taken[item - shared->d_items].add(1);
+}
+
+void* thief(void* arg) {
+  my_Shared* shared = static_cast<my_Shared*>(arg);
+  while (true) {
+    const bool done = shared->d_done.loadAcquire();
+    int* item = shared->d_deque.steal();
+    if (item) {
+      take(shared, item);
+    } else if (done && 0 == shared->d_deque.size()) {
+      return 0;
+    }
+  }
+}
+
+TEST(WorkStealingDequeTest, EachItemIsTakenOnce) {
+  my_Shared* shared = new my_Shared;
+  shared->d_done.storeRelaxed(false);
+
+  pthread_t threads[k_num_thieves];
+  for (int i = 0; i < k_num_thieves; ++i) {
+    ASSERT_EQ(0, pthread_create(&threads[i], 0, &thief, shared));
+  }
+
+  // Push in bursts and pop some back, so that the owner races the thieves
+  // for the last element.
+  for (int i = 0; i < k_num_items; ++i) {
+    shared->d_deque.push(&shared->d_items[i]);
+    if (0 == i % 4) {
+      int* item = shared->d_deque.pop();
+      if (item) {
+        take(shared, item);
+      }
+    }
+  }
+  while (int* item = shared->d_deque.pop()) {
+    take(shared, item);
+  }
+  shared->d_done.storeRelease(true);
+  for (int i = 0; i < k_num_thieves; ++i) {
+    pthread_join(threads[i], 0);
+  }
+
+  for (int i = 0; i < k_num_items; ++i) {
+    ASSERT_EQ(1, shared->d_taken[i].loadRelaxed()) << i;
+  }
+  delete shared;
+}
+
+}  // namespace
+}  // namespace llcl